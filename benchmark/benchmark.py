@@ -30,6 +30,15 @@ class ErrorHandlingSystem(object):
         "Function implementation for final function zero"
         return r'''{ return par ? -1 : 0; }'''
 
+    def function_body(self, prev):
+        "Function implementation for every function but zero"
+        return r'''
+{
+  RAII raii;
+  return ''' + prev + r'''(par + 1);
+}
+'''
+
     def generate_sources(self, no):
         "Generate no source files calling into one another"
         for n in range(0, no):
@@ -42,12 +51,7 @@ struct RAII { RAII() { ++counter; } ~RAII() { --counter; } };
                     oh.write(self.function_cont("funct%04d" % (n-1)) + ';\n')
                 oh.write(self.function_cont("funct%04d" % n))
                 if n:
-                    oh.write(r'''
-{
-  RAII raii;
-  return ''' + ("funct%04d" % (n-1)) + r'''(par + 1);
-}
-''')
+                    oh.write(self.function_body("funct%04d" % (n-1)))
                 else:
                     oh.write(self.function_final())
         with open("function.h", 'wt') as oh:
@@ -74,6 +78,27 @@ class ResultErrorError(ResultErrorValue):
     def function_final(self):
         return r'''{ return std::error_code(5, std::generic_category()); }'''
 
+class ResultErrorTry(ResultErrorError):
+    "Every function has a TRY and a failure return site, as is typical of real code"
+    def preamble(self, idx):
+        return '#include "../include/outcome/result.hpp"\n#include "../include/outcome/try.hpp"\n'
+    def function_body(self, prev):
+        return r'''
+{
+  RAII raii;
+  OUTCOME_TRY(auto v, ''' + prev + r'''(par + 1));
+  if(v < -1) return OUTCOME_V2_NAMESPACE::failure(std::errc::invalid_argument);
+  return v;
+}
+'''
+
+class ResultErrorTryOutlined(ResultErrorTry):
+    "As ResultErrorTry, but failures are constructed by one out of line function per result type"
+    def preamble(self, idx):
+        return '#define OUTCOME_OUTLINE_TRY_FAILURES 1\n' + ResultErrorTry.preamble(self, idx)
+    def function_body(self, prev):
+        return ResultErrorTry.function_body(self, prev).replace('OUTCOME_V2_NAMESPACE::failure(', 'OUTCOME_V2_NAMESPACE::outline_failure(')
+
 class ResultExceptionValue(ResultErrorValue):
     def function_cont(self, name):
         return 'extern OUTCOME_V2_NAMESPACE::result<int, std::exception_ptr> %s(int par)' % name
@@ -103,6 +128,8 @@ matrix = [
     ('exception-throw', ExceptionThrow),
     ('result-error-value', ResultErrorValue),
     ('result-error-error', ResultErrorError),
+    ('result-error-try', ResultErrorTry),
+    ('result-error-try-outlined', ResultErrorTryOutlined),
     ('result-excpt-value', ResultExceptionValue),
     ('result-excpt-error', ResultExceptionError),
     ('result-exper-value', ResultExperimentalValue),
@@ -128,20 +155,36 @@ else:
         ('clang90-lto', r'clang++-9 -std=c++17 -O3 -g -flto -o %s -I../.. -I../../quickcpplib/include'),
     ]
 
+def text_size(exename):
+    "Size of the code in the executable, or of the whole executable if that can't be determined"
+    if sys.platform != 'win32':
+        try:
+            for line in subprocess.check_output(['size', '-A', exename]).decode('utf-8').splitlines():
+                fields = line.split()
+                if len(fields) > 1 and fields[0] == '.text':
+                    return int(fields[1])
+        except (OSError, subprocess.CalledProcessError):
+            pass
+        return os.path.getsize(exename)
+    return os.path.getsize(exename + '.exe')
+
 SOURCES=10
 if len(sys.argv)>1:
     SOURCES = int(sys.argv[1])
 
-with open('results-'+sys.platform+'.csv', 'wt') as resultsh:
-    resultsh.write('"Compiler"')
-    for m in matrix:
-        resultsh.write(',"'+m[0]+'"')
-    resultsh.write('\n')
+with open('results-'+sys.platform+'.csv', 'wt') as resultsh, open('sizes-'+sys.platform+'.csv', 'wt') as sizesh:
+    for h in (resultsh, sizesh):
+        h.write('"Compiler"')
+        for m in matrix:
+            h.write(',"'+m[0]+'"')
+        h.write('\n')
     for compiler in compilers:
         resultsh.write('"'+compiler[0]+'"')
+        sizesh.write('"'+compiler[0]+'"')
         for m in matrix:
             if 'noexcept' in compiler[0] and m[0] == 'exception-throw':
                 resultsh.write(',')
+                sizesh.write(',')
                 continue
             instance = m[1]()
             try:
@@ -180,7 +223,10 @@ with open('results-'+sys.platform+'.csv', 'wt') as resultsh:
                     os.remove("runner.obj")
             if sys.platform != 'win32':
                 exename = './' + exename
+            sizesh.write(',%d' % text_size(exename))
+            sizesh.flush()
             result = subprocess.check_output([exename]).decode('utf-8')
             resultsh.write(',' + result.rstrip())
             resultsh.flush()
         resultsh.write('\n')
+        sizesh.write('\n')
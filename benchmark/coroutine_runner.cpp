@@ -0,0 +1,77 @@
+/* Benchmark test runner for coroutines
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "timing.h"
+#include <stdio.h>
+#include "function.h"
+
+// Keeps the total number of calls roughly constant as the nesting deepens
+#define ITERATIONS (NESTING >= 100 ? 10000 : 100000)
+
+extern volatile int counter;
+volatile int counter, forcereturn;
+
+// Plain returns
+inline int run(int v)
+{
+  return !v;
+}
+template <class T> inline int run(T &&r)
+{
+  return r.has_value();
+}
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+// Awaitables are driven to completion as the outermost co_await would
+template <class Cont, bool suspend_initial, bool use_atomic> inline int run(OUTCOME_V2_NAMESPACE::awaitables::detail::awaitable<Cont, suspend_initial, use_atomic> &&a)
+{
+  if(!a.await_ready())
+  {
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    a.await_suspend({}).resume();
+#else
+    a.await_suspend({});
+#endif
+  }
+  return a.await_resume().has_value();
+}
+#endif
+
+int main(void)
+{
+  {
+    usCount start = GetUsCount();
+    while(GetUsCount() - start < 1 * 1000000000000LL)
+      ;
+  }
+  auto start = ticksclock();
+  for(int n = 0; n < ITERATIONS; n++)
+  {
+    forcereturn += run(FUNCTION(n));
+  }
+  auto end = ticksclock();
+  double ticks = end - start;
+  ticks /= ITERATIONS;
+  printf("%f\n", ticks);
+  return 0;
+}
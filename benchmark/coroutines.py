@@ -0,0 +1,201 @@
+#!/usr/bin/python
+# Benchmark Outcome's awaitables against plain returns at increasing nesting depths
+# (C) 2026 Niall Douglas http://www.nedproductions.biz/
+# Created: Oct 2026
+
+from __future__ import print_function
+import sys, os, subprocess, shlex, time
+
+# Some Python 3 compatibility shims
+if sys.version_info.major < 3:
+    clock = time.clock
+else:
+    clock = time.perf_counter
+
+class PlainReturns(object):
+    "Base class for a way of returning through nested calls"
+
+    def preamble(self):
+        "Preamble written out before each source file"
+        return ''
+
+    def function_cont(self, name):
+        "Function signature"
+        return 'extern int %s(int par)' % name
+
+    def function_final(self):
+        "Function implementation for final function zero"
+        return r'''{ return par ? -1 : 0; }'''
+
+    def function_body(self, prev):
+        "Function implementation for every function but zero"
+        return r'''
+{
+  RAII raii;
+  return ''' + prev + r'''(par + 1);
+}
+'''
+
+    def generate_sources(self, nesting, files):
+        """Generate nesting functions calling into one another, spread round robin over files
+        source files so that no function can be inlined into its caller"""
+        for n in range(0, files):
+            with open("source%04d.cpp" % n, 'wt') as oh:
+                oh.write(self.preamble())
+                oh.write(r'''extern volatile int counter;
+struct RAII { RAII() { ++counter; } ~RAII() { --counter; } };
+''')
+                for f in range(n, nesting, files):
+                    if f:
+                        oh.write(self.function_cont("funct%04d" % (f-1)) + ';\n')
+                    oh.write(self.function_cont("funct%04d" % f))
+                    if f:
+                        oh.write(self.function_body("funct%04d" % (f-1)))
+                    else:
+                        oh.write(self.function_final() + '\n')
+        with open("function.h", 'wt') as oh:
+            oh.write(self.preamble())
+            oh.write(self.function_cont("funct%04d" % (nesting-1)) + ';\n')
+            oh.write("#define FUNCTION funct%04d\n" % (nesting-1))
+            oh.write("#define NESTING %d\n" % (nesting))
+
+class ResultReturns(PlainReturns):
+    def preamble(self):
+        return '#include "../include/outcome/result.hpp"\n#include "../include/outcome/try.hpp"\n'
+    def function_cont(self, name):
+        return 'extern OUTCOME_V2_NAMESPACE::result<int> %s(int par)' % name
+    def function_final(self):
+        return r'''{ return par; }'''
+    def function_body(self, prev):
+        return r'''
+{
+  RAII raii;
+  OUTCOME_TRY(auto v, ''' + prev + r'''(par + 1));
+  return v;
+}
+'''
+
+class AwaitableValue(ResultReturns):
+    "Every function is a coroutine returning the co_await of the next"
+    awaitable = 'eager'
+    def preamble(self):
+        return '#include "../include/outcome/coroutine_support.hpp"\n' + ResultReturns.preamble(self)
+    def function_cont(self, name):
+        return 'extern OUTCOME_V2_NAMESPACE::awaitables::%s<OUTCOME_V2_NAMESPACE::result<int>> %s(int par)' % (self.awaitable, name)
+    def function_final(self):
+        return r'''{ co_return par; }'''
+    def function_body(self, prev):
+        return r'''
+{
+  RAII raii;
+  co_return co_await ''' + prev + r'''(par + 1);
+}
+'''
+
+class LazyValue(AwaitableValue):
+    awaitable = 'lazy'
+
+class AtomicEagerValue(AwaitableValue):
+    awaitable = 'atomic_eager'
+
+class AtomicLazyValue(AwaitableValue):
+    awaitable = 'atomic_lazy'
+
+class LazyTryError(LazyValue):
+    "The final coroutine fails, and the failure propagates through OUTCOME_CO_TRY in every other"
+    def function_final(self):
+        return r'''{ co_return std::error_code(5, std::generic_category()); }'''
+    def function_body(self, prev):
+        return r'''
+{
+  RAII raii;
+  OUTCOME_CO_TRY(auto v, co_await ''' + prev + r'''(par + 1));
+  co_return v;
+}
+'''
+
+class LazyExceptionError(LazyTryError):
+    "The final coroutine throws, which its promise converts into an error with error_from_exception()"
+    def preamble(self):
+        return '#include <system_error>\n' + LazyTryError.preamble(self)
+    def function_final(self):
+        return r'''{ if(par >= 0) throw std::system_error(std::make_error_code(std::errc::io_error)); co_return par; }'''
+
+matrix = [
+    ('integer-returns', PlainReturns),
+    ('result-returns', ResultReturns),
+    ('eager-value', AwaitableValue),
+    ('lazy-value', LazyValue),
+    ('atomic-eager-value', AtomicEagerValue),
+    ('atomic-lazy-value', AtomicLazyValue),
+    ('lazy-try-error', LazyTryError),
+    ('lazy-excpt-error', LazyExceptionError),
+]
+
+if sys.platform == 'win32':
+    compilers = [
+        ('msvc1930', r'cl /nologo /std:c++20 /O2 /Gy /MD /EHsc /Fe%s /I..\\.. /I..\\..\\quickcpplib\\include'),
+    ]
+elif sys.platform == 'darwin':
+    compilers = [
+        ('xcode14', r'clang++ -std=c++20 -O3 -g -o %s -I../.. -I../../quickcpplib/include'),
+    ]
+else:
+    compilers = [
+        ('gcc12-noexcept', r'g++-12 -std=c++20 -fcoroutines -DOUTCOME_HAVE_NOOP_COROUTINE=1 -fno-exceptions -O3 -g -o %s -I../.. -I../../quickcpplib/include'),
+        ('gcc12', r'g++-12 -std=c++20 -fcoroutines -DOUTCOME_HAVE_NOOP_COROUTINE=1 -O3 -g -o %s -I../.. -I../../quickcpplib/include'),
+        ('clang15', r'clang++-15 -std=c++20 -O3 -g -o %s -I../.. -I../../quickcpplib/include'),
+    ]
+
+NESTINGS = [1, 10, 100, 1000]
+if len(sys.argv)>1:
+    NESTINGS = [int(x) for x in sys.argv[1:]]
+
+# One row per compiler and nesting depth, in the same layout as results-*.csv
+with open('results-coroutines-'+sys.platform+'.csv', 'wt') as resultsh:
+    resultsh.write('"Compiler"')
+    for m in matrix:
+        resultsh.write(',"'+m[0]+'"')
+    resultsh.write('\n')
+    for compiler in compilers:
+        for nesting in NESTINGS:
+            files = min(nesting, 10)
+            resultsh.write('"'+compiler[0]+'-'+str(nesting)+'"')
+            for m in matrix:
+                if 'noexcept' in compiler[0] and 'excpt' in m[0]:
+                    resultsh.write(',')
+                    continue
+                instance = m[1]()
+                try:
+                    exename = m[0]+'_'+compiler[0]+'_'+str(nesting)
+                    print("\nGenerating sources for", exename, "...")
+                    instance.generate_sources(nesting, files)
+                    args = shlex.split(compiler[1] % exename)
+                    args.append("coroutine_runner.cpp")
+                    for n in range(0, files):
+                        args.append("source%04d.cpp" % n)
+                    try:
+                        print("Compiling", exename, "...")
+                        compile_begin = clock()
+                        print(subprocess.check_output(args))
+                        compile_end = clock()
+                        print("Compile took", compile_end-compile_begin, "secs. Running executable ...")
+                    except subprocess.CalledProcessError as e:
+                        print(e.output)
+                        raise
+                finally:
+                    for n in range(0, files):
+                        if os.path.exists("source%04d.cpp" % n):
+                            os.remove("source%04d.cpp" % n)
+                        if os.path.exists("source%04d.obj" % n):
+                            os.remove("source%04d.obj" % n)
+                    os.remove("function.h")
+                    if os.path.exists("coroutine_runner.obj"):
+                        os.remove("coroutine_runner.obj")
+                if sys.platform != 'win32':
+                    exename = './' + exename
+                result = subprocess.check_output([exename]).decode('utf-8')
+                resultsh.write(',' + result.rstrip())
+                resultsh.flush()
+                os.remove(exename if sys.platform != 'win32' else exename + '.exe')
+            resultsh.write('\n')
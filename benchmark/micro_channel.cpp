@@ -0,0 +1,106 @@
+/* Benchmark of channel<T> throughput within one thread and between two
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/coroutine_channel.hpp"
+#include "../include/outcome/coroutine_executor.hpp"
+#include "../include/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#include "microbenchmark.h"
+
+#include <thread>
+
+static constexpr int iterations = 10000000;
+
+namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+template <class T> using result = OUTCOME_V2_NAMESPACE::result<T>;
+using channel = awaitables::channel<result<int>>;
+
+// Sends zero to count - 1, then closes
+inline awaitables::atomic_lazy<result<void>> producer(channel *ch, int count)
+{
+  for(int n = 0; n < count; n++)
+  {
+    OUTCOME_CO_TRY(co_await ch->send(n));
+  }
+  ch->close();
+  co_return OUTCOME_V2_NAMESPACE::success();
+}
+// Receives until the channel closes, summing the values
+inline awaitables::atomic_lazy<result<long long>> consumer(channel *ch)
+{
+  long long sum = 0;
+  for(;;)
+  {
+    auto r = co_await ch->recv();
+    if(r)
+    {
+      sum += r.value();
+    }
+    else if(r.error() == std::errc::broken_pipe && ch->is_closed())
+    {
+      co_return sum;
+    }
+  }
+}
+template <class T> inline void start(T &t)
+{
+#if OUTCOME_HAVE_NOOP_COROUTINE
+  t.await_suspend({}).resume();
+#else
+  t.await_suspend({});
+#endif
+}
+
+int main(void)
+{
+  char desc[64];
+  for(size_t capacity : {2, 64})
+  {
+    // Within one thread the producer and consumer alternate each time the buffer fills
+    channel ch(capacity);
+    auto c = consumer(&ch);
+    auto p = producer(&ch, iterations);
+    const double ns = microbenchmark::ns_per(iterations, [&] {
+      start(c);
+      start(p);
+    });
+    microbenchmark::require(c.await_ready() && c.await_resume().value() == (long long) iterations * (iterations - 1) / 2, "a value was lost");
+    snprintf(desc, sizeof(desc), "One thread, capacity %zu", ch.capacity());
+    microbenchmark::report(desc, ns, "value");
+  }
+  for(size_t capacity : {2, 64})
+  {
+    channel ch(capacity);
+    result<long long> sum(0);
+    const double ns = microbenchmark::ns_per(iterations, [&] {
+      std::thread consuming([&] { sum = awaitables::sync_wait(consumer(&ch)); });
+      microbenchmark::require(awaitables::sync_wait(producer(&ch, iterations)).has_value(), "the producer failed");
+      consuming.join();
+    });
+    microbenchmark::require(sum.value() == (long long) iterations * (iterations - 1) / 2, "a value was lost");
+    snprintf(desc, sizeof(desc), "Two threads, capacity %zu", ch.capacity());
+    microbenchmark::report(desc, ns, "value");
+  }
+  return 0;
+}
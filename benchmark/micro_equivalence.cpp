@@ -0,0 +1,65 @@
+/* Benchmark of tabulated equivalence to errc against asking the domains
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/experimental/status_equivalence.hpp"
+#include "microbenchmark.h"
+
+static constexpr int iterations = 10000000;
+
+namespace outcome_e = OUTCOME_V2_NAMESPACE::experimental;
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+using platform_domain = outcome_e::_posix_code_domain;
+using platform_code = outcome_e::posix_code;
+#else
+using platform_domain = outcome_e::_generic_code_domain;
+using platform_code = outcome_e::generic_code;
+#endif
+
+inline platform_code code_of(int n)
+{
+  return platform_code(SYSTEM_ERROR2_NAMESPACE::in_place, static_cast<platform_domain::value_type>(n));
+}
+
+int main(void)
+{
+  outcome_e::status_equivalences().add<platform_domain>(code_of(0).value(), code_of(200).value());
+  const outcome_e::system_code codes[] = {code_of(ENOENT), code_of(EACCES), code_of(ETIMEDOUT), code_of(EAGAIN)};
+  int matched = 0;
+  const double domains = microbenchmark::ns_per(iterations, [&] {
+    for(int n = 0; n < iterations; n++)
+    {
+      matched += (codes[n & 3] == outcome_e::errc::timed_out);
+    }
+  });
+  const double table = microbenchmark::ns_per(iterations, [&] {
+    for(int n = 0; n < iterations; n++)
+    {
+      matched -= outcome_e::is_equivalent(codes[n & 3], outcome_e::errc::timed_out);
+    }
+  });
+  microbenchmark::require(matched == 0, "the table and the domains disagree");
+  microbenchmark::report("Asking the domains", domains, "comparison");
+  microbenchmark::report("The table         ", table, "comparison");
+  return 0;
+}
@@ -0,0 +1,106 @@
+/* Benchmark of error_from_exception() against rethrowing through a ladder of catch clauses
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/utils.hpp"
+#include "microbenchmark.h"
+
+#include <stdexcept>
+
+static constexpr int iterations = 1000000;
+
+// error_from_exception() before the registry, to compare against
+inline std::error_code rethrow_ladder(std::exception_ptr &&ep, std::error_code not_matched = std::make_error_code(std::errc::resource_unavailable_try_again)) noexcept
+{
+  try
+  {
+    std::rethrow_exception(ep);
+  }
+  catch(const std::invalid_argument & /*unused*/)
+  {
+    return std::make_error_code(std::errc::invalid_argument);
+  }
+  catch(const std::domain_error & /*unused*/)
+  {
+    return std::make_error_code(std::errc::argument_out_of_domain);
+  }
+  catch(const std::length_error & /*unused*/)
+  {
+    return std::make_error_code(std::errc::argument_list_too_long);
+  }
+  catch(const std::out_of_range & /*unused*/)
+  {
+    return std::make_error_code(std::errc::result_out_of_range);
+  }
+  catch(const std::logic_error & /*unused*/)
+  {
+    return std::make_error_code(std::errc::invalid_argument);
+  }
+  catch(const std::system_error &e)
+  {
+    return e.code();
+  }
+  catch(const std::overflow_error & /*unused*/)
+  {
+    return std::make_error_code(std::errc::value_too_large);
+  }
+  catch(const std::range_error & /*unused*/)
+  {
+    return std::make_error_code(std::errc::result_out_of_range);
+  }
+  catch(const std::runtime_error & /*unused*/)
+  {
+    return std::make_error_code(std::errc::resource_unavailable_try_again);
+  }
+  catch(const std::bad_alloc & /*unused*/)
+  {
+    return std::make_error_code(std::errc::not_enough_memory);
+  }
+  catch(...)
+  {
+  }
+  return not_matched;
+}
+
+int main(void)
+{
+  const std::exception_ptr eps[] = {std::make_exception_ptr(std::bad_alloc()), std::make_exception_ptr(std::invalid_argument("invalid argument")),
+                                    std::make_exception_ptr(std::runtime_error("runtime error"))};
+  int matched = 0;
+  const double ladder = microbenchmark::ns_per(iterations, [&] {
+    for(int n = 0; n < iterations; n++)
+    {
+      matched += !!rethrow_ladder(std::exception_ptr(eps[n % 3]));
+    }
+  });
+  const double registry = microbenchmark::ns_per(iterations, [&] {
+    for(int n = 0; n < iterations; n++)
+    {
+      matched -= !!OUTCOME_V2_NAMESPACE::error_from_exception(std::exception_ptr(eps[n % 3]));
+    }
+  });
+  microbenchmark::require(matched == 0, "the ladder and the registry disagree");
+  microbenchmark::report("Rethrowing through a ladder of catch clauses", ladder, "exception");
+  microbenchmark::report("error_from_exception()                      ", registry, "exception");
+  return 0;
+}
@@ -0,0 +1,82 @@
+/* Benchmark of fan out and fan in on the work stealing executor from one to all cores
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/coroutine_executor.hpp"
+#include "../include/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#include "microbenchmark.h"
+
+#include <thread>
+
+static constexpr unsigned depth = 12, work = 20;
+
+namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+template <class T> using result = OUTCOME_V2_NAMESPACE::result<T>;
+
+// Burns roughly a microsecond per unit of work
+inline unsigned spin(unsigned work)
+{
+  volatile unsigned x = 0;
+  for(unsigned n = 0; n < work * 250; n++)
+  {
+    x = x + n;
+  }
+  return x;
+}
+
+// Fans out into 2^depth leaves, each run on the executor, then fans their results back in
+inline awaitables::atomic_lazy<result<unsigned>> fan_out(awaitables::work_stealing_executor &ex, unsigned depth, unsigned work)
+{
+  if(depth == 0)
+  {
+    co_await ex.schedule();
+    spin(work);
+    co_return 1U;
+  }
+  OUTCOME_CO_TRY(auto v, co_await awaitables::when_all(fan_out(ex, depth - 1, work), fan_out(ex, depth - 1, work)));
+  co_return std::get<0>(v) + std::get<1>(v);
+}
+
+int main(void)
+{
+  const unsigned cores = (std::thread::hardware_concurrency() > 0) ? std::thread::hardware_concurrency() : 1;
+  double single = 0;
+  for(unsigned threads = 1;; threads = (threads * 2 < cores) ? threads * 2 : cores)
+  {
+    awaitables::work_stealing_executor ex(threads);
+    result<unsigned> r(0U);
+    const double ms = microbenchmark::ns_per(1, [&] { r = awaitables::sync_wait(fan_out(ex, depth, work)); }) / 1000000.0;
+    microbenchmark::require(r.value() == (1U << depth), "a leaf was lost");
+    if(threads == 1)
+    {
+      single = ms;
+    }
+    printf("%u threads: %u leaves in %.2f ms, speedup %.2f\n", threads, 1U << depth, ms, single / ms);
+    if(threads == cores)
+    {
+      break;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,91 @@
+/* Benchmark of co_await throughput with and without frame recycling
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/coroutine_support.hpp"
+#include "../include/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#include "microbenchmark.h"
+
+#include <memory>
+
+// Symmetric transfer must be a tail call, else each co_await costs stack, so build this with optimisation
+static constexpr int iterations = 1000000;
+
+template <class T> using lazy = OUTCOME_V2_NAMESPACE::awaitables::lazy<T>;
+template <class T> using result = OUTCOME_V2_NAMESPACE::result<T>;
+
+inline lazy<result<int>> lazy_int(int x)
+{
+  co_return x + 1;
+}
+// Allocator aware coroutines bypass the frame recycling
+template <class Alloc> inline lazy<result<int>> lazy_int_alloc(std::allocator_arg_t /*unused*/, Alloc /*unused*/, int x)
+{
+  co_return x + 1;
+}
+
+inline lazy<result<int>> recycled()
+{
+  int total = 0;
+  for(int n = 0; n < iterations; n++)
+  {
+    OUTCOME_CO_TRY(auto v, co_await lazy_int(n));
+    total += v & 1;
+  }
+  co_return total;
+}
+inline lazy<result<int>> allocated()
+{
+  int total = 0;
+  for(int n = 0; n < iterations; n++)
+  {
+    OUTCOME_CO_TRY(auto v, co_await lazy_int_alloc(std::allocator_arg, std::allocator<char>(), n));
+    total += v & 1;
+  }
+  co_return total;
+}
+
+template <class F> inline void run(const char *desc, F &&f)
+{
+  auto t = f();
+  const double ns = microbenchmark::ns_per(iterations, [&] {
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    t.await_suspend({}).resume();
+#else
+    t.await_suspend({});
+#endif
+  });
+  microbenchmark::require(t.await_ready() && t.await_resume().value() == iterations / 2, "the coroutine did not complete every co_await");
+  microbenchmark::report(desc, ns, "co_await");
+}
+
+int main(void)
+{
+#if !OUTCOME_COROUTINE_RECYCLE_FRAMES
+  printf("NOTE: frame recycling is disabled in this build, both rows allocate through operator new\n");
+#endif
+  run("Recycled frames    ", recycled);
+  run("operator new frames", allocated);
+  return 0;
+}
@@ -0,0 +1,109 @@
+/* Benchmark of generator<T> against materialising a vector and against a callback
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/coroutine_support.hpp"
+#include "../include/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#include "microbenchmark.h"
+
+#include <string>
+#include <vector>
+
+static constexpr int records = 10000000;
+
+template <class T> using generator = OUTCOME_V2_NAMESPACE::awaitables::generator<T>;
+template <class T> using result = OUTCOME_V2_NAMESPACE::result<T>;
+
+inline result<int> parse_digit(char c)
+{
+  if(c < '0' || c > '9')
+  {
+    return std::errc::invalid_argument;
+  }
+  return c - '0';
+}
+
+// Yields every record, each of which may fail independently
+inline generator<result<int>> parse_all(const char *s)
+{
+  for(; *s != 0; ++s)
+  {
+    co_yield parse_digit(*s);
+  }
+  co_return OUTCOME_V2_NAMESPACE::success();
+}
+
+volatile int sink;
+
+inline void materialised(const std::string &input)
+{
+  std::vector<result<int>> all;
+  for(char c : input)
+  {
+    all.push_back(parse_digit(c));
+  }
+  int total = 0;
+  for(auto &r : all)
+  {
+    total += r.value();
+  }
+  sink = total;
+}
+template <class F> inline void parse(const std::string &input, F &&f)
+{
+  for(char c : input)
+  {
+    f(parse_digit(c));
+  }
+}
+inline void callback(const std::string &input)
+{
+  int total = 0;
+  parse(input, [&total](result<int> r) { total += r.value(); });
+  sink = total;
+}
+inline void generated(const std::string &input)
+{
+  int total = 0;
+  auto g = parse_all(input.c_str());
+  for(int v : g.values())
+  {
+    total += v;
+  }
+  microbenchmark::require(g.status().has_value(), "the generator failed");
+  sink = total;
+}
+
+int main(void)
+{
+  std::string input(records, '0');
+  for(size_t n = 0; n < input.size(); n++)
+  {
+    input[n] = static_cast<char>('0' + n % 10);
+  }
+  microbenchmark::report("Materialised vector", microbenchmark::ns_per(records, [&] { materialised(input); }), "record");
+  microbenchmark::report("Callback           ", microbenchmark::ns_per(records, [&] { callback(input); }), "record");
+  microbenchmark::report("generator<T>       ", microbenchmark::ns_per(records, [&] { generated(input); }), "record");
+  return 0;
+}
@@ -0,0 +1,87 @@
+/* Benchmark of failing with an inline message against one in a payload on the heap
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/experimental/inline_message_code.hpp"
+#include "../include/outcome/experimental/status-code/include/status_code_ptr.hpp"
+#include "../include/outcome/try.hpp"
+#include "microbenchmark.h"
+
+#include <cstring>
+
+static constexpr size_t iterations = 10000000;
+
+namespace outcome_e = OUTCOME_V2_NAMESPACE::experimental;
+template <class T> using result = outcome_e::status_result<T, outcome_e::inline_message_code>;
+
+OUTCOME_NOINLINE inline result<int> lookup(const char *key) noexcept
+{
+  if(key[0] != 'k')
+  {
+    return outcome_e::inline_message_code(outcome_e::in_place, outcome_e::errc::invalid_argument, "key does not begin with 'k'");
+  }
+  return static_cast<int>(strlen(key));
+}
+inline result<int> lookup_twice(const char *key) noexcept
+{
+  OUTCOME_TRY(auto v, lookup(key));
+  return v * 2;
+}
+
+// The same, but with the message in a payload on the heap
+OUTCOME_NOINLINE inline outcome_e::status_result<int> lookup_ptr(const char *key) noexcept
+{
+  if(key[0] != 'k')
+  {
+    return outcome_e::make_status_code_ptr(outcome_e::inline_message_code(outcome_e::in_place, outcome_e::errc::invalid_argument, "key does not begin with 'k'"));
+  }
+  return static_cast<int>(strlen(key));
+}
+inline outcome_e::status_result<int> lookup_ptr_twice(const char *key) noexcept
+{
+  OUTCOME_TRY(auto v, lookup_ptr(key));
+  return v * 2;
+}
+
+int main(void)
+{
+  // Half of the calls fail
+  const char *keys[] = {"key", "xyz"};
+  size_t failures = 0;
+  const double inline_message = microbenchmark::ns_per(iterations, [&] {
+    for(size_t n = 0; n < iterations; n++)
+    {
+      failures += lookup_twice(keys[n & 1]).has_error();
+    }
+  });
+  const double heap_message = microbenchmark::ns_per(iterations, [&] {
+    for(size_t n = 0; n < iterations; n++)
+    {
+      failures -= lookup_ptr_twice(keys[n & 1]).has_error();
+    }
+  });
+  microbenchmark::require(failures == 0, "the two ways of failing disagree");
+  microbenchmark::report("With an inline message    ", inline_message, "call");
+  microbenchmark::report("With a message on the heap", heap_message, "call");
+  return 0;
+}
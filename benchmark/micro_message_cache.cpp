@@ -0,0 +1,62 @@
+/* Benchmark of interned status code messages against asking the domain
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/experimental/status_message_cache.hpp"
+#include "microbenchmark.h"
+
+static constexpr int iterations = 1000000;
+
+namespace outcome_e = OUTCOME_V2_NAMESPACE::experimental;
+
+// A code for errno value `n`, whose message comes from the platform where it can
+inline outcome_e::system_code code_of(int n)
+{
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+  return outcome_e::posix_code(n);
+#else
+  return outcome_e::generic_code(static_cast<outcome_e::errc>(n));
+#endif
+}
+
+int main(void)
+{
+  const outcome_e::system_code codes[] = {code_of(ENOENT), code_of(EACCES), code_of(ETIMEDOUT)};
+  size_t length = 0;
+  const double domain = microbenchmark::ns_per(iterations, [&] {
+    for(int n = 0; n < iterations; n++)
+    {
+      length += codes[n % 3].message().size();
+    }
+  });
+  const double cached = microbenchmark::ns_per(iterations, [&] {
+    for(int n = 0; n < iterations; n++)
+    {
+      length -= outcome_e::cached_message(codes[n % 3]).size();
+    }
+  });
+  microbenchmark::require(length == 0, "the cache and the domain disagree");
+  microbenchmark::report("Asking the domain", domain, "message");
+  microbenchmark::report("From the cache   ", cached, "message");
+  return 0;
+}
@@ -0,0 +1,154 @@
+/* Benchmark of round trips through the epoll reactor over a socketpair and a pipe
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/coroutine_reactor.hpp"
+#include "../include/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#include "microbenchmark.h"
+
+#include <vector>
+
+#include <fcntl.h>
+
+static constexpr size_t rounds = 100000;
+
+namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+template <class T> using lazy = awaitables::lazy<T>;
+template <class T> using result = OUTCOME_V2_NAMESPACE::result<T>;
+
+inline result<std::pair<awaitables::async_fd, awaitables::async_fd>> make_socketpair(awaitables::epoll_reactor &reactor)
+{
+  int fds[2];
+  if(-1 == ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds))
+  {
+    return std::error_code(errno, std::generic_category());
+  }
+  OUTCOME_TRY(auto a, reactor.attach(fds[0]));
+  OUTCOME_TRY(auto b, reactor.attach(fds[1]));
+  return {std::move(a), std::move(b)};
+}
+
+// Reads exactly `bytes`, failing on end of file
+inline lazy<result<void>> read_exactly(awaitables::async_fd &fd, char *buffer, size_t bytes)
+{
+  while(bytes > 0)
+  {
+    OUTCOME_CO_TRY(auto read, co_await fd.read(buffer, bytes));
+    if(read == 0)
+    {
+      co_return std::errc::connection_reset;
+    }
+    buffer += read;
+    bytes -= read;
+  }
+  co_return OUTCOME_V2_NAMESPACE::success();
+}
+inline lazy<result<void>> write_all(awaitables::async_fd &fd, const char *buffer, size_t bytes)
+{
+  while(bytes > 0)
+  {
+    OUTCOME_CO_TRY(auto written, co_await fd.write(buffer, bytes));
+    buffer += written;
+    bytes -= written;
+  }
+  co_return OUTCOME_V2_NAMESPACE::success();
+}
+// Echoes back `rounds` messages of `bytes` read from `in` to `out`
+inline lazy<result<void>> echo(awaitables::async_fd &in, awaitables::async_fd &out, size_t bytes)
+{
+  std::vector<char> buffer(bytes);
+  for(size_t n = 0; n < rounds; n++)
+  {
+    OUTCOME_CO_TRY(co_await read_exactly(in, buffer.data(), bytes));
+    OUTCOME_CO_TRY(co_await write_all(out, buffer.data(), bytes));
+  }
+  co_return OUTCOME_V2_NAMESPACE::success();
+}
+// Sends `rounds` messages of `bytes` to `out`, awaiting each echo from `in`
+inline lazy<result<void>> ping(awaitables::async_fd &out, awaitables::async_fd &in, size_t bytes)
+{
+  std::vector<char> sent(bytes), received(bytes);
+  for(size_t n = 0; n < rounds; n++)
+  {
+    sent[0] = static_cast<char>(n);
+    OUTCOME_CO_TRY(co_await write_all(out, sent.data(), bytes));
+    OUTCOME_CO_TRY(co_await read_exactly(in, received.data(), bytes));
+    if(received != sent)
+    {
+      co_return std::errc::illegal_byte_sequence;
+    }
+  }
+  co_return OUTCOME_V2_NAMESPACE::success();
+}
+
+template <class T> inline void start(T &t)
+{
+#if OUTCOME_HAVE_NOOP_COROUTINE
+  t.await_suspend({}).resume();
+#else
+  t.await_suspend({});
+#endif
+}
+
+// Times `rounds` round trips, each of which is two writes and two reads
+inline double round_trips(awaitables::epoll_reactor &reactor, awaitables::async_fd &there_write, awaitables::async_fd &there_read, awaitables::async_fd &back_write,
+                          awaitables::async_fd &back_read, size_t bytes)
+{
+  auto e = echo(there_read, back_write, bytes);
+  auto p = ping(there_write, back_read, bytes);
+  const double ns = microbenchmark::ns_per(rounds, [&] {
+    start(e);
+    start(p);
+    while(!(p.await_ready() && e.await_ready()))
+    {
+      microbenchmark::require(reactor.run_once(1000).has_value(), "the reactor failed");
+    }
+  });
+  microbenchmark::require(p.await_resume().has_value() && e.await_resume().has_value(), "a round trip failed");
+  return ns;
+}
+
+int main(void)
+{
+  auto reactor = awaitables::epoll_reactor::create();
+  microbenchmark::require(reactor.has_value(), "the reactor could not be created");
+  for(size_t bytes : {1, 4096})
+  {
+    auto pair = make_socketpair(reactor.value());
+    microbenchmark::require(pair.has_value(), "the socketpair could not be created");
+    const double ns = round_trips(reactor.value(), pair.value().first, pair.value().second, pair.value().second, pair.value().first, bytes);
+    microbenchmark::report((bytes == 1) ? "socketpair, 1 byte    " : "socketpair, 4096 bytes", ns, "round trip");
+  }
+  {
+    // Two pipes, one in each direction
+    int there[2], back[2];
+    microbenchmark::require(0 == ::pipe2(there, O_NONBLOCK | O_CLOEXEC) && 0 == ::pipe2(back, O_NONBLOCK | O_CLOEXEC), "the pipes could not be created");
+    auto there_read = reactor.value().attach(there[0]), there_write = reactor.value().attach(there[1]);
+    auto back_read = reactor.value().attach(back[0]), back_write = reactor.value().attach(back[1]);
+    microbenchmark::require(there_read && there_write && back_read && back_write, "the pipes could not be attached");
+    const double ns = round_trips(reactor.value(), there_write.value(), there_read.value(), back_write.value(), back_read.value(), 1);
+    microbenchmark::report("pipe, 1 byte          ", ns, "round trip");
+  }
+  return 0;
+}
@@ -0,0 +1,88 @@
+/* Benchmark of throwing standard exceptions through the table against switching on errno
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/utils.hpp"
+#include "microbenchmark.h"
+
+#include <stdexcept>
+
+static constexpr int iterations = 1000000;
+
+// try_throw_std_exception_from_error() before the table, to compare against. Out of line, as
+// each thrower is, so both unwind the same number of frames.
+OUTCOME_NOINLINE inline void switch_on_errno(std::error_code ec, const std::string &msg = std::string{})
+{
+  switch(ec.value())
+  {
+  case EINVAL:
+    throw msg.empty() ? std::invalid_argument("invalid argument") : std::invalid_argument(msg);
+  case EDOM:
+    throw msg.empty() ? std::domain_error("domain error") : std::domain_error(msg);
+  case E2BIG:
+    throw msg.empty() ? std::length_error("length error") : std::length_error(msg);
+  case ERANGE:
+    throw msg.empty() ? std::out_of_range("out of range") : std::out_of_range(msg);
+  case EOVERFLOW:
+    throw msg.empty() ? std::overflow_error("overflow error") : std::overflow_error(msg);
+  case ENOMEM:
+    throw std::bad_alloc();
+  }
+}
+
+int main(void)
+{
+  const std::error_code codes[] = {std::make_error_code(std::errc::invalid_argument), std::make_error_code(std::errc::result_out_of_range),
+                                   std::make_error_code(std::errc::value_too_large)};
+  int caught = 0;
+  const double switched = microbenchmark::ns_per(iterations, [&] {
+    for(int n = 0; n < iterations; n++)
+    {
+      try
+      {
+        switch_on_errno(codes[n % 3]);
+      }
+      catch(const std::exception & /*unused*/)
+      {
+        caught++;
+      }
+    }
+  });
+  const double tabled = microbenchmark::ns_per(iterations, [&] {
+    for(int n = 0; n < iterations; n++)
+    {
+      try
+      {
+        OUTCOME_V2_NAMESPACE::try_throw_std_exception_from_error(codes[n % 3]);
+      }
+      catch(const std::exception & /*unused*/)
+      {
+        caught--;
+      }
+    }
+  });
+  microbenchmark::require(caught == 0, "the switch and the table disagree");
+  microbenchmark::report("Switching on errno        ", switched, "throw");
+  microbenchmark::report("Throwing through the table", tabled, "throw");
+  return 0;
+}
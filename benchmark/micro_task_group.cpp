@@ -0,0 +1,110 @@
+/* Benchmark of scatter gather through a task group against awaiting each child in turn
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/coroutine_task_group.hpp"
+#include "../include/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#include "microbenchmark.h"
+
+static constexpr int iterations = 10000;
+static constexpr int shards = 128;
+
+namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+template <class T> using lazy = awaitables::lazy<T>;
+template <class T> using result = OUTCOME_V2_NAMESPACE::result<T>;
+using group_type = awaitables::task_group<result<int>>;
+
+// A shard whose frame comes from the group's arena
+inline lazy<result<int>> shard(std::allocator_arg_t /*unused*/, group_type::allocator_type /*unused*/, int n)
+{
+  co_return n * 2;
+}
+inline lazy<result<int>> sum_in_group(group_type &group)
+{
+  for(int n = 0; n < shards; n++)
+  {
+    OUTCOME_CO_TRY(group.spawn(shard(std::allocator_arg, group.get_allocator(), n)));
+  }
+  OUTCOME_CO_TRY(co_await group.join());
+  int total = 0;
+  for(int n = 0; n < shards; n++)
+  {
+    total += group.values()[n];
+  }
+  co_return total;
+}
+inline lazy<result<int>> unpooled_shard(int n)
+{
+  co_return n * 2;
+}
+inline lazy<result<int>> sum_sequentially()
+{
+  int total = 0;
+  for(int n = 0; n < shards; n++)
+  {
+    OUTCOME_CO_TRY(auto v, co_await unpooled_shard(n));
+    total += v;
+  }
+  co_return total;
+}
+
+template <class T> inline void start(T &t)
+{
+#if OUTCOME_HAVE_NOOP_COROUTINE
+  t.await_suspend({}).resume();
+#else
+  t.await_suspend({});
+#endif
+}
+
+int main(void)
+{
+#if OUTCOME_HAVE_STOP_TOKEN
+  group_type group(shards);
+  int total = 0;
+  const double grouped = microbenchmark::ns_per(static_cast<size_t>(iterations) * shards, [&] {
+    for(int n = 0; n < iterations; n++)
+    {
+      auto t = sum_in_group(group);
+      start(t);
+      total += t.await_resume().value();
+      group.reset();
+    }
+  });
+  const double sequential = microbenchmark::ns_per(static_cast<size_t>(iterations) * shards, [&] {
+    for(int n = 0; n < iterations; n++)
+    {
+      auto t = sum_sequentially();
+      start(t);
+      total -= t.await_resume().value();
+    }
+  });
+  microbenchmark::require(total == 0, "the two ways of summing differ");
+  microbenchmark::report("Task group of 128 children", grouped, "child");
+  microbenchmark::report("Awaiting each in turn     ", sequential, "child");
+#else
+  printf("NOTE: this standard library has no std::stop_token, so there is no task_group to benchmark\n");
+#endif
+  return 0;
+}
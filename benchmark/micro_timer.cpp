@@ -0,0 +1,65 @@
+/* Benchmark of scheduling and cancelling many concurrent deadlines
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/coroutine_timer.hpp"
+#include "microbenchmark.h"
+
+#include <deque>
+
+static constexpr size_t count = 1000000;
+
+int main(void)
+{
+#if OUTCOME_HAVE_STOP_TOKEN
+  namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+  awaitables::timer_service service;
+  std::deque<awaitables::detail::deadline_timer> timers;
+  std::stop_source source;
+  for(size_t n = 0; n < count; n++)
+  {
+    timers.emplace_back(&source);
+  }
+  const double scheduling = microbenchmark::ns_per(count, [&] {
+    for(size_t n = 0; n < count; n++)
+    {
+      // Spread over every level of the wheel
+      service.schedule(timers[n], std::chrono::milliseconds(1000 + (n * 7919) % 10000000));
+    }
+  });
+  size_t fired = 0;
+  const double cancelling = microbenchmark::ns_per(count, [&] {
+    for(size_t n = 0; n < count; n++)
+    {
+      fired += service.cancel(timers[n]);
+    }
+  });
+  microbenchmark::require(fired == 0 && !source.stop_requested(), "a deadline fired");
+  printf("With %zu deadlines pending:\n", count);
+  microbenchmark::report("Scheduling", scheduling, "deadline");
+  microbenchmark::report("Cancelling", cancelling, "deadline");
+#else
+  printf("NOTE: this standard library has no std::stop_token, so there is no timer_service to benchmark\n");
+#endif
+  return 0;
+}
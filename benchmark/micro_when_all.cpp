@@ -0,0 +1,94 @@
+/* Benchmark of when_all() and when_any() against awaiting each child in turn
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../include/outcome/coroutine_support.hpp"
+#include "../include/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#include "microbenchmark.h"
+
+static constexpr int iterations = 1000000;
+
+namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+template <class T> using lazy = awaitables::lazy<T>;
+template <class T> using result = OUTCOME_V2_NAMESPACE::result<T>;
+
+inline lazy<result<int>> lazy_int(int x)
+{
+  co_return x + 1;
+}
+
+inline lazy<result<int>> sequential()
+{
+  int total = 0;
+  for(int n = 0; n < iterations; n++)
+  {
+    OUTCOME_CO_TRY(auto a, co_await lazy_int(n));
+    OUTCOME_CO_TRY(auto b, co_await lazy_int(n));
+    OUTCOME_CO_TRY(auto c, co_await lazy_int(n));
+    total += (a + b + c) & 1;
+  }
+  co_return total;
+}
+inline lazy<result<int>> all()
+{
+  int total = 0;
+  for(int n = 0; n < iterations; n++)
+  {
+    OUTCOME_CO_TRY(auto v, co_await awaitables::when_all(lazy_int(n), lazy_int(n), lazy_int(n)));
+    total += (std::get<0>(v) + std::get<1>(v) + std::get<2>(v)) & 1;
+  }
+  co_return total;
+}
+inline lazy<result<int>> any()
+{
+  int total = 0;
+  for(int n = 0; n < iterations; n++)
+  {
+    OUTCOME_CO_TRY(auto v, co_await awaitables::when_any(lazy_int(n), lazy_int(n), lazy_int(n)));
+    total += v & 1;
+  }
+  co_return total;
+}
+
+template <class F> inline void run(const char *desc, F &&f)
+{
+  auto t = f();
+  const double ns = microbenchmark::ns_per(iterations, [&] {
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    t.await_suspend({}).resume();
+#else
+    t.await_suspend({});
+#endif
+  });
+  microbenchmark::require(t.await_ready() && t.await_resume().value() == iterations / 2, "the coroutine did not complete every co_await");
+  microbenchmark::report(desc, ns, "three children");
+}
+
+int main(void)
+{
+  run("Sequential co_await", sequential);
+  run("when_all()         ", all);
+  run("when_any()         ", any);
+  return 0;
+}
@@ -0,0 +1,62 @@
+/* Timing and reporting shared by the microbenchmarks
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef MICROBENCHMARK_H
+#define MICROBENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+namespace microbenchmark
+{
+  // Calls f() once, returning the nanoseconds it took divided by the count of operations it did
+  template <class F> inline double ns_per(size_t count, F &&f)
+  {
+    auto begin = std::chrono::high_resolution_clock::now();
+    f();
+    auto end = std::chrono::high_resolution_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count()) / count;
+  }
+
+  // Prints "desc: ns ns per unit (operations per second)"
+  inline void report(const char *desc, double ns, const char *unit)
+  {
+    printf("%s: %.2f ns per %s (%.0f per second)\n", desc, ns, unit, 1000000000.0 / ns);
+    fflush(stdout);
+  }
+
+  // Aborts the benchmark if what it measured did not do the work expected of it
+  inline void require(bool ok, const char *what)
+  {
+    if(!ok)
+    {
+      fprintf(stderr, "FATAL: %s\n", what);
+      abort();
+    }
+  }
+}  // namespace microbenchmark
+
+#endif
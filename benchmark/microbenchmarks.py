@@ -0,0 +1,65 @@
+#!/usr/bin/python
+# Build and run the microbenchmarks of individual Outcome facilities with each compiler
+# (C) 2026 Niall Douglas http://www.nedproductions.biz/
+# Created: Oct 2026
+
+from __future__ import print_function
+import sys, os, subprocess, shlex
+
+# Each microbenchmark is a single source file printing one line per measurement
+programs = [
+    ('frame-allocation', 'micro_frame_allocation.cpp'),
+    ('when-all', 'micro_when_all.cpp'),
+    ('generator', 'micro_generator.cpp'),
+    ('executor', 'micro_executor.cpp'),
+    ('channel', 'micro_channel.cpp'),
+    ('timer', 'micro_timer.cpp'),
+    ('task-group', 'micro_task_group.cpp'),
+    ('exception-registry', 'micro_exception_registry.cpp'),
+    ('std-exception', 'micro_std_exception.cpp'),
+    ('message-cache', 'micro_message_cache.cpp'),
+    ('equivalence', 'micro_equivalence.cpp'),
+    ('inline-message', 'micro_inline_message.cpp'),
+]
+if sys.platform.startswith('linux'):
+    programs.append(('reactor', 'micro_reactor.cpp'))
+
+if sys.platform == 'win32':
+    compilers = [
+        ('msvc1930', r'cl /nologo /std:c++20 /O2 /Gy /MD /EHsc /Fe%s /I..\\.. /I..\\..\\quickcpplib\\include'),
+    ]
+elif sys.platform == 'darwin':
+    compilers = [
+        ('xcode14', r'clang++ -std=c++20 -O3 -g -o %s -I../.. -I../../quickcpplib/include'),
+    ]
+else:
+    compilers = [
+        ('gcc12', r'g++-12 -std=c++20 -fcoroutines -DOUTCOME_HAVE_NOOP_COROUTINE=1 -O3 -g -pthread -o %s -I../.. -I../../quickcpplib/include'),
+        ('clang15', r'clang++-15 -std=c++20 -O3 -g -pthread -o %s -I../.. -I../../quickcpplib/include'),
+    ]
+
+if len(sys.argv)>1:
+    programs = [p for p in programs if p[0] in sys.argv[1:]]
+
+with open('results-microbenchmarks-'+sys.platform+'.txt', 'wt') as resultsh:
+    for compiler in compilers:
+        for program in programs:
+            exename = program[0]+'_'+compiler[0]
+            args = shlex.split(compiler[1] % exename)
+            args.append(program[1])
+            try:
+                print("Compiling", exename, "...")
+                print(subprocess.check_output(args))
+            except subprocess.CalledProcessError as e:
+                print(e.output)
+                raise
+            if os.path.exists(program[1][:-4] + '.obj'):
+                os.remove(program[1][:-4] + '.obj')
+            if sys.platform != 'win32':
+                exename = './' + exename
+            print("Running", exename, "...")
+            result = subprocess.check_output([exename]).decode('utf-8')
+            print(result)
+            resultsh.write('*** ' + program[0] + ' ' + compiler[0] + ' ***\n' + result + '\n')
+            resultsh.flush()
+            os.remove(exename if sys.platform != 'win32' else exename + '.exe')
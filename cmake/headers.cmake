@@ -8,7 +8,12 @@ set(outcome_HEADERS
   "include/outcome/boost_result.hpp"
   "include/outcome/config.hpp"
   "include/outcome/convert.hpp"
+  "include/outcome/coroutine_channel.hpp"
+  "include/outcome/coroutine_executor.hpp"
+  "include/outcome/coroutine_reactor.hpp"
   "include/outcome/coroutine_support.hpp"
+  "include/outcome/coroutine_task_group.hpp"
+  "include/outcome/coroutine_timer.hpp"
   "include/outcome/detail/basic_outcome_exception_observers.hpp"
   "include/outcome/detail/basic_outcome_exception_observers_impl.hpp"
   "include/outcome/detail/basic_outcome_failure_observers.hpp"
@@ -22,7 +27,11 @@ set(outcome_HEADERS
   "include/outcome/detail/trait_std_exception.hpp"
   "include/outcome/detail/value_storage.hpp"
   "include/outcome/detail/version.hpp"
+  "include/outcome/error_map.hpp"
+  "include/outcome/error_payload.hpp"
+  "include/outcome/experimental/c_result_view.hpp"
   "include/outcome/experimental/coroutine_support.hpp"
+  "include/outcome/experimental/inline_message_code.hpp"
   "include/outcome/experimental/result.h"
   "include/outcome/experimental/status-code/include/com_code.hpp"
   "include/outcome/experimental/status-code/include/config.hpp"
@@ -48,6 +57,8 @@ set(outcome_HEADERS
   "include/outcome/experimental/status-code/include/system_error2.hpp"
   "include/outcome/experimental/status-code/include/win32_code.hpp"
   "include/outcome/experimental/status-code/single-header/system_error2.hpp"
+  "include/outcome/experimental/status_equivalence.hpp"
+  "include/outcome/experimental/status_message_cache.hpp"
   "include/outcome/experimental/status_outcome.hpp"
   "include/outcome/experimental/status_result.hpp"
   "include/outcome/iostream_support.hpp"
@@ -68,5 +79,6 @@ set(outcome_HEADERS
   "include/outcome/success_failure.hpp"
   "include/outcome/trait.hpp"
   "include/outcome/try.hpp"
+  "include/outcome/try_all.hpp"
   "include/outcome/utils.hpp"
 )
@@ -7,11 +7,23 @@ set(outcome_TESTS
   "test/tests/containers.cpp"
   "test/tests/core-outcome.cpp"
   "test/tests/core-result.cpp"
+  "test/tests/coroutine-channel.cpp"
+  "test/tests/coroutine-executor.cpp"
+  "test/tests/coroutine-reactor.cpp"
   "test/tests/coroutine-support.cpp"
+  "test/tests/coroutine-task-group.cpp"
+  "test/tests/coroutine-timer.cpp"
   "test/tests/default-construction.cpp"
+  "test/tests/error-map.cpp"
+  "test/tests/error-payload.cpp"
+  "test/tests/exception-error-registry.cpp"
+  "test/tests/experimental-c-result.cpp"
   "test/tests/experimental-core-outcome-status.cpp"
   "test/tests/experimental-core-result-status.cpp"
+  "test/tests/experimental-inline-message-code.cpp"
   "test/tests/experimental-p0709a.cpp"
+  "test/tests/experimental-status-equivalence.cpp"
+  "test/tests/experimental-status-message-cache.cpp"
   "test/tests/fileopen.cpp"
   "test/tests/hooks.cpp"
   "test/tests/issue0007.cpp"
@@ -35,10 +47,13 @@ set(outcome_TESTS
   "test/tests/issue0244.cpp"
   "test/tests/issue0247.cpp"
   "test/tests/noexcept-propagation.cpp"
+  "test/tests/outline-failure.cpp"
   "test/tests/propagate.cpp"
   "test/tests/serialisation.cpp"
+  "test/tests/std-exception-from-error.cpp"
   "test/tests/success-failure.cpp"
   "test/tests/swap.cpp"
+  "test/tests/try-all.cpp"
   "test/tests/udts.cpp"
   "test/tests/value-or-error.cpp"
 )
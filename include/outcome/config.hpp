@@ -49,6 +49,9 @@ Distributed under the Boost Software License, Version 1.0.
 
 #ifdef DOXYGEN_IS_IN_THE_HOUSE
 #define OUTCOME_FORCEINLINE
+#define OUTCOME_NOINLINE
+#define OUTCOME_NORETURN [[noreturn]]
+#define OUTCOME_COLD
 #define OUTCOME_NODISCARD [[nodiscard]]
 #define OUTCOME_TEMPLATE(...) template <__VA_ARGS__
 #define OUTCOME_TREQUIRES(...) , __VA_ARGS__ >
@@ -69,6 +72,19 @@ SIGNATURE NOT RECOGNISED
 #ifndef OUTCOME_NODISCARD
 #define OUTCOME_NODISCARD QUICKCPPLIB_NODISCARD
 #endif
+#ifndef OUTCOME_NOINLINE
+#define OUTCOME_NOINLINE QUICKCPPLIB_NOINLINE
+#endif
+#ifndef OUTCOME_NORETURN
+#define OUTCOME_NORETURN QUICKCPPLIB_NORETURN
+#endif
+#ifndef OUTCOME_COLD
+#if defined(__GNUC__) || defined(__clang__)
+#define OUTCOME_COLD __attribute__((cold))
+#else
+#define OUTCOME_COLD
+#endif
+#endif
 #ifndef OUTCOME_THREAD_LOCAL
 #define OUTCOME_THREAD_LOCAL QUICKCPPLIB_THREAD_LOCAL
 #endif
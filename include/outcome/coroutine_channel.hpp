@@ -0,0 +1,541 @@
+/* A bounded channel of results for Outcome's awaitables
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_COROUTINE_CHANNEL_HPP
+#define OUTCOME_COROUTINE_CHANNEL_HPP
+
+#include "coroutine_support.hpp"
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+namespace awaitables
+{
+  namespace detail
+  {
+    /* Dmitry Vyukov's bounded multi-producer multi-consumer queue. Each cell carries a sequence
+    number saying whether it is free to be written on the lap of the ring a producer is on, or
+    holds a value to be read on the lap a consumer is on. Producers and consumers claim cells
+    by compare and swap of the tail and head respectively, so neither ever waits on the other.
+    */
+    template <class T> class bounded_ring
+    {
+      struct cell
+      {
+        std::atomic<size_t> seq{0};
+        union
+        {
+          OUTCOME_V2_NAMESPACE::detail::empty_type _default{};
+          T value;
+        };
+
+        cell() noexcept {}
+        cell(const cell &) = delete;
+        cell &operator=(const cell &) = delete;
+        ~cell() {}
+      };
+
+      size_t _mask;
+      std::unique_ptr<cell[]> _cells;
+      alignas(64) std::atomic<size_t> _tail{0};
+      alignas(64) std::atomic<size_t> _head{0};
+
+      static size_t _round_up(size_t capacity) noexcept
+      {
+        size_t ret = 2;
+        while(ret < capacity)
+        {
+          ret *= 2;
+        }
+        return ret;
+      }
+
+    public:
+      //! Constructs a ring of `capacity` rounded up to a power of two, and at least two.
+      explicit bounded_ring(size_t capacity)
+          : _mask(_round_up(capacity) - 1)
+          , _cells(new cell[_mask + 1])  // could throw
+      {
+        for(size_t n = 0; n <= _mask; n++)
+        {
+          _cells[n].seq.store(n, std::memory_order_relaxed);
+        }
+      }
+      bounded_ring(const bounded_ring &) = delete;
+      bounded_ring &operator=(const bounded_ring &) = delete;
+      ~bounded_ring()
+      {
+        for(size_t pos = _head.load(std::memory_order_relaxed); pos != _tail.load(std::memory_order_relaxed); ++pos)
+        {
+          _cells[pos & _mask].value.~T();
+        }
+      }
+
+      size_t capacity() const noexcept { return _mask + 1; }
+
+      //! Moves `v` into the ring if there is space, returning false if full.
+      bool try_push(T &v)
+      {
+        size_t pos = _tail.load(std::memory_order_relaxed);
+        for(;;)
+        {
+          cell &c = _cells[pos & _mask];
+          const size_t seq = c.seq.load(std::memory_order_acquire);
+          const auto diff = static_cast<ptrdiff_t>(seq - pos);
+          if(diff == 0)
+          {
+            if(_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed, std::memory_order_relaxed))
+            {
+              new(&c.value) T(static_cast<T &&>(v));  // could throw
+              c.seq.store(pos + 1, std::memory_order_release);
+              return true;
+            }
+          }
+          else if(diff < 0)
+          {
+            return false;
+          }
+          else
+          {
+            pos = _tail.load(std::memory_order_relaxed);
+          }
+        }
+      }
+      //! Moves the oldest value in the ring into the uninitialised storage at `dest`, returning false if empty.
+      bool try_pop(T *dest)
+      {
+        size_t pos = _head.load(std::memory_order_relaxed);
+        for(;;)
+        {
+          cell &c = _cells[pos & _mask];
+          const size_t seq = c.seq.load(std::memory_order_acquire);
+          const auto diff = static_cast<ptrdiff_t>(seq - (pos + 1));
+          if(diff == 0)
+          {
+            if(_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed, std::memory_order_relaxed))
+            {
+              new(dest) T(static_cast<T &&>(c.value));  // could throw
+              c.value.~T();
+              c.seq.store(pos + _mask + 1, std::memory_order_release);
+              return true;
+            }
+          }
+          else if(diff < 0)
+          {
+            return false;
+          }
+          else
+          {
+            pos = _head.load(std::memory_order_relaxed);
+          }
+        }
+      }
+    };
+
+    // A coroutine suspended in channel::send() or channel::recv(), living in its awaiter
+    template <class T> struct channel_waiter
+    {
+      coroutine_handle<> awaiting;
+      channel_waiter *next{nullptr};
+      T *value{nullptr};    // the value to send, or the storage to receive into
+      bool queued{false};   // protected by the channel's lock
+      bool done{false};     // sent, or received into value
+    };
+    template <class T> struct channel_waiter_queue
+    {
+      channel_waiter<T> *head{nullptr}, *tail{nullptr};
+
+      bool empty() const noexcept { return head == nullptr; }
+      void push(channel_waiter<T> *w) noexcept
+      {
+        w->next = nullptr;
+        w->queued = true;
+        if(tail != nullptr)
+        {
+          tail->next = w;
+        }
+        else
+        {
+          head = w;
+        }
+        tail = w;
+      }
+      channel_waiter<T> *pop() noexcept
+      {
+        channel_waiter<T> *w = head;
+        head = w->next;
+        if(head == nullptr)
+        {
+          tail = nullptr;
+        }
+        w->next = nullptr;
+        w->queued = false;
+        return w;
+      }
+      bool remove(channel_waiter<T> *w) noexcept
+      {
+        channel_waiter<T> *prev = nullptr;
+        for(channel_waiter<T> *i = head; i != nullptr; prev = i, i = i->next)
+        {
+          if(i == w)
+          {
+            (prev != nullptr ? prev->next : head) = w->next;
+            if(tail == w)
+            {
+              tail = prev;
+            }
+            w->queued = false;
+            return true;
+          }
+        }
+        return false;
+      }
+    };
+    // Waiters taken off the channel's queues, to be resumed once its lock is released
+    template <class T> struct channel_ready_list
+    {
+      channel_waiter<T> *head{nullptr}, *tail{nullptr};
+
+      bool empty() const noexcept { return head == nullptr; }
+      void push(channel_waiter<T> *w) noexcept
+      {
+        (tail != nullptr ? tail->next : head) = w;
+        tail = w;
+      }
+      void resume_all()
+      {
+        channel_waiter<T> *w = head;
+        head = tail = nullptr;
+        while(w != nullptr)
+        {
+          channel_waiter<T> *next = w->next;  // w may be destroyed once resumed
+          w->awaiting.resume();
+          w = next;
+        }
+      }
+    };
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class Cont> class channel
+  {
+    static_assert(OUTCOME_V2_NAMESPACE::is_basic_result<Cont>::value, "channel<T> requires T to be a basic_result");
+    static_assert(std::is_constructible<Cont, std::errc>::value, "channel<T> requires T to be constructible from errc::broken_pipe");
+
+  public:
+    using value_type = Cont;
+    using error_type = typename Cont::error_type;
+    using status_type = basic_result<void, error_type, typename detail::rebind_no_value_policy<typename Cont::no_value_policy_type, void>::type>;
+
+  private:
+    using waiter = detail::channel_waiter<Cont>;
+    using waiter_queue = detail::channel_waiter_queue<Cont>;
+    using ready_list = detail::channel_ready_list<Cont>;
+
+    /* Sends and receives which can complete immediately touch only the ring, plus a load of the
+    count of waiters on the other side. A coroutine which must wait takes the lock, counts itself
+    as waiting and retries the ring before queueing. Whoever then pushes or pops the ring checks
+    the count after a full fence, so either the retry sees their change, or they see the waiter,
+    take the lock and complete its operation for it before resuming it.
+    */
+    detail::bounded_ring<Cont> _ring;
+    std::atomic<size_t> _receivers_waiting{0};
+    std::atomic<size_t> _senders_waiting{0};
+    std::atomic<bool> _closed{false};
+    std::mutex _lock;
+    waiter_queue _receivers, _senders;  // protected by _lock
+
+    // After a push, hands values in the ring to waiting receivers
+    void _wake_receivers()
+    {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if(_receivers_waiting.load(std::memory_order_relaxed) == 0)
+      {
+        return;
+      }
+      ready_list ready;
+      {
+        std::lock_guard<std::mutex> g(_lock);
+        while(!_receivers.empty() && _ring.try_pop(_receivers.head->value))
+        {
+          waiter *w = _receivers.pop();
+          w->done = true;
+          _receivers_waiting.fetch_sub(1, std::memory_order_relaxed);
+          ready.push(w);
+        }
+      }
+      ready.resume_all();
+    }
+    // After a pop, moves the values of waiting senders into the ring
+    void _wake_senders()
+    {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if(_senders_waiting.load(std::memory_order_relaxed) == 0)
+      {
+        return;
+      }
+      ready_list ready;
+      {
+        std::lock_guard<std::mutex> g(_lock);
+        while(!_senders.empty() && _ring.try_push(*_senders.head->value))
+        {
+          waiter *w = _senders.pop();
+          w->done = true;
+          _senders_waiting.fetch_sub(1, std::memory_order_relaxed);
+          ready.push(w);
+        }
+      }
+      if(!ready.empty())
+      {
+        _wake_receivers();
+      }
+      ready.resume_all();
+    }
+    void _cancel(waiter *w, waiter_queue &q, std::atomic<size_t> &count) noexcept
+    {
+      std::lock_guard<std::mutex> g(_lock);
+      if(q.remove(w))
+      {
+        count.fetch_sub(1, std::memory_order_relaxed);
+      }
+    }
+
+  public:
+    //! The awaitable returned by `send()`.
+    class OUTCOME_NODISCARD send_awaitable
+    {
+      friend class channel;
+      channel *_ch;
+      Cont _value;
+      waiter _w;
+
+      send_awaitable(channel *ch, Cont &&v)
+          : _ch(ch)
+          , _value(static_cast<Cont &&>(v))
+      {
+      }
+
+    public:
+      send_awaitable(const send_awaitable &) = delete;
+      send_awaitable(send_awaitable &&) = delete;
+      send_awaitable &operator=(const send_awaitable &) = delete;
+      send_awaitable &operator=(send_awaitable &&) = delete;
+      // A coroutine destroyed while waiting to send withdraws its value
+      ~send_awaitable()
+      {
+        if(_w.queued)
+        {
+          _ch->_cancel(&_w, _ch->_senders, _ch->_senders_waiting);
+        }
+      }
+
+      bool await_ready()
+      {
+        if(_ch->_closed.load(std::memory_order_acquire))
+        {
+          return true;
+        }
+        if(_ch->_ring.try_push(_value))
+        {
+          _w.done = true;
+          _ch->_wake_receivers();
+          return true;
+        }
+        return false;
+      }
+      bool await_suspend(coroutine_handle<> h)
+      {
+        {
+          std::lock_guard<std::mutex> g(_ch->_lock);
+          _ch->_senders_waiting.fetch_add(1, std::memory_order_relaxed);
+          std::atomic_thread_fence(std::memory_order_seq_cst);
+          if(_ch->_closed.load(std::memory_order_relaxed))
+          {
+            _ch->_senders_waiting.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+          }
+          if(!_ch->_ring.try_push(_value))
+          {
+            _w.awaiting = h;
+            _w.value = &_value;
+            _ch->_senders.push(&_w);
+            // Once the lock is released, this awaiter may be resumed and destroyed at any time
+            return true;
+          }
+          _ch->_senders_waiting.fetch_sub(1, std::memory_order_relaxed);
+          _w.done = true;
+        }
+        _ch->_wake_receivers();
+        return false;
+      }
+      //! Success if the value was placed into the channel, otherwise `errc::broken_pipe` as the channel was closed.
+      status_type await_resume()
+      {
+        if(_w.done)
+        {
+          return status_type{in_place_type<void>};
+        }
+        return status_type{std::errc::broken_pipe};
+      }
+    };
+
+    //! The awaitable returned by `recv()`.
+    class OUTCOME_NODISCARD recv_awaitable
+    {
+      friend class channel;
+      channel *_ch;
+      union
+      {
+        OUTCOME_V2_NAMESPACE::detail::empty_type _default{};
+        Cont _result;
+      };
+      waiter _w;
+
+      explicit recv_awaitable(channel *ch) noexcept
+          : _ch(ch)
+      {
+      }
+
+    public:
+      recv_awaitable(const recv_awaitable &) = delete;
+      recv_awaitable(recv_awaitable &&) = delete;
+      recv_awaitable &operator=(const recv_awaitable &) = delete;
+      recv_awaitable &operator=(recv_awaitable &&) = delete;
+      ~recv_awaitable()
+      {
+        if(_w.done)
+        {
+          _result.~Cont();
+        }
+        else if(_w.queued)
+        {
+          _ch->_cancel(&_w, _ch->_receivers, _ch->_receivers_waiting);
+        }
+      }
+
+      bool await_ready()
+      {
+        if(_ch->_ring.try_pop(&_result))
+        {
+          _w.done = true;
+          _ch->_wake_senders();
+          return true;
+        }
+        return false;
+      }
+      bool await_suspend(coroutine_handle<> h)
+      {
+        {
+          std::lock_guard<std::mutex> g(_ch->_lock);
+          _ch->_receivers_waiting.fetch_add(1, std::memory_order_relaxed);
+          std::atomic_thread_fence(std::memory_order_seq_cst);
+          if(!_ch->_ring.try_pop(&_result))
+          {
+            if(_ch->_closed.load(std::memory_order_relaxed))
+            {
+              _ch->_receivers_waiting.fetch_sub(1, std::memory_order_relaxed);
+              new(&_result) Cont(std::errc::broken_pipe);
+              _w.done = true;
+              return false;
+            }
+            _w.awaiting = h;
+            _w.value = &_result;
+            _ch->_receivers.push(&_w);
+            // Once the lock is released, this awaiter may be resumed and destroyed at any time
+            return true;
+          }
+          _ch->_receivers_waiting.fetch_sub(1, std::memory_order_relaxed);
+          _w.done = true;
+        }
+        _ch->_wake_senders();
+        return false;
+      }
+      //! The oldest value sent, otherwise `errc::broken_pipe` if the channel is closed and empty.
+      Cont await_resume() { return static_cast<Cont &&>(_result); }
+    };
+
+    //! Constructs a channel buffering `capacity` values, rounded up to a power of two and at least two.
+    explicit channel(size_t capacity)
+        : _ring(capacity)
+    {
+    }
+    channel(const channel &) = delete;
+    channel(channel &&) = delete;
+    channel &operator=(const channel &) = delete;
+    channel &operator=(channel &&) = delete;
+    //! No coroutine may be waiting on a channel being destroyed. Values still buffered are destroyed.
+    ~channel() = default;
+
+    //! The number of values which can be buffered.
+    size_t capacity() const noexcept { return _ring.capacity(); }
+    //! True once `close()` has been called.
+    bool is_closed() const noexcept { return _closed.load(std::memory_order_acquire); }
+
+    //! Returns an awaitable which places `v` into the channel, waiting while it is full.
+    send_awaitable send(Cont v) { return send_awaitable(this, static_cast<Cont &&>(v)); }
+    //! Returns an awaitable which takes the oldest value from the channel, waiting while it is empty.
+    recv_awaitable recv() noexcept { return recv_awaitable(this); }
+
+    /*! Closes the channel. Waiting senders complete with `errc::broken_pipe`, and their values are
+    dropped, as do all later sends. Waiting receivers take any values still buffered, and after
+    that all receives complete with `errc::broken_pipe`. Waiters are resumed by the calling thread.
+    */
+    void close()
+    {
+      ready_list ready;
+      {
+        std::lock_guard<std::mutex> g(_lock);
+        _closed.store(true, std::memory_order_release);
+        while(!_receivers.empty())
+        {
+          waiter *w = _receivers.pop();
+          if(!_ring.try_pop(w->value))
+          {
+            new(w->value) Cont(std::errc::broken_pipe);
+          }
+          w->done = true;
+          ready.push(w);
+        }
+        while(!_senders.empty())
+        {
+          ready.push(_senders.pop());
+        }
+        _receivers_waiting.store(0, std::memory_order_relaxed);
+        _senders_waiting.store(0, std::memory_order_relaxed);
+      }
+      ready.resume_all();
+    }
+  };
+}  // namespace awaitables
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
+#endif
@@ -0,0 +1,462 @@
+/* A work stealing executor for Outcome's awaitables
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_COROUTINE_EXECUTOR_HPP
+#define OUTCOME_COROUTINE_EXECUTOR_HPP
+
+#include "coroutine_support.hpp"
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+namespace awaitables
+{
+  namespace detail
+  {
+    /* The Chase-Lev work stealing deque, with the memory orderings given by Lê, Pop, Cohen and
+    Zappa Nardelli in "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+    Only the owning thread may push and pop, at the bottom. Any thread may steal, from the top.
+    Arrays which have been outgrown are kept until the deque is destroyed, as a thief may still
+    be reading from one.
+    */
+    class work_stealing_deque
+    {
+      struct array
+      {
+        size_t mask;
+        std::unique_ptr<std::atomic<void *>[]> slots;
+
+        explicit array(size_t capacity)
+            : mask(capacity - 1)
+            , slots(new std::atomic<void *>[capacity])
+        {
+        }
+        void *get(int64_t i) const noexcept { return slots[static_cast<size_t>(i) & mask].load(std::memory_order_relaxed); }
+        void put(int64_t i, void *v) noexcept { slots[static_cast<size_t>(i) & mask].store(v, std::memory_order_relaxed); }
+      };
+
+      alignas(64) std::atomic<int64_t> _top{0};
+      alignas(64) std::atomic<int64_t> _bottom{0};
+      std::atomic<array *> _array{nullptr};
+      std::vector<std::unique_ptr<array>> _arrays;
+
+      array *_grow(array *a, int64_t bottom, int64_t top)
+      {
+        _arrays.push_back(std::unique_ptr<array>(new array((a->mask + 1) * 2)));  // could throw
+        array *ret = _arrays.back().get();
+        for(int64_t i = top; i < bottom; i++)
+        {
+          ret->put(i, a->get(i));
+        }
+        _array.store(ret, std::memory_order_release);
+        return ret;
+      }
+
+    public:
+      //! Constructs a deque with an initial `capacity`, which must be a power of two.
+      explicit work_stealing_deque(size_t capacity = 256)
+      {
+        _arrays.push_back(std::unique_ptr<array>(new array(capacity)));
+        _array.store(_arrays.back().get(), std::memory_order_relaxed);
+      }
+      work_stealing_deque(const work_stealing_deque &) = delete;
+      work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+
+      //! Pushes onto the bottom. Owner only.
+      void push(void *v)
+      {
+        const int64_t b = _bottom.load(std::memory_order_relaxed);
+        const int64_t t = _top.load(std::memory_order_acquire);
+        array *a = _array.load(std::memory_order_relaxed);
+        if(b - t > static_cast<int64_t>(a->mask))
+        {
+          a = _grow(a, b, t);
+        }
+        a->put(b, v);
+        std::atomic_thread_fence(std::memory_order_release);
+        _bottom.store(b + 1, std::memory_order_relaxed);
+      }
+      //! Pops from the bottom, returning null if empty. Owner only.
+      void *pop() noexcept
+      {
+        const int64_t b = _bottom.load(std::memory_order_relaxed) - 1;
+        array *a = _array.load(std::memory_order_relaxed);
+        _bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = _top.load(std::memory_order_relaxed);
+        if(t > b)
+        {
+          _bottom.store(b + 1, std::memory_order_relaxed);
+          return nullptr;
+        }
+        void *ret = a->get(b);
+        if(t == b)
+        {
+          // Last item, race any thieves for it
+          if(!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+          {
+            ret = nullptr;
+          }
+          _bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return ret;
+      }
+      //! Steals from the top, returning null if empty or if another thread won the race. Any thread.
+      void *steal() noexcept
+      {
+        int64_t t = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = _bottom.load(std::memory_order_acquire);
+        if(t >= b)
+        {
+          return nullptr;
+        }
+        array *a = _array.load(std::memory_order_acquire);
+        void *ret = a->get(t);
+        if(!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+          return nullptr;
+        }
+        return ret;
+      }
+      //! An estimate of the number of items, exact when quiescent.
+      size_t size() const noexcept
+      {
+        const int64_t b = _bottom.load(std::memory_order_relaxed);
+        const int64_t t = _top.load(std::memory_order_relaxed);
+        return (b > t) ? static_cast<size_t>(b - t) : 0;
+      }
+    };
+
+    struct sync_wait_state
+    {
+      std::mutex lock;
+      std::condition_variable cond;
+      bool done{false};
+    };
+
+    // Runs the awaited coroutine to completion, then signals whoever is blocked in sync_wait()
+    struct OUTCOME_NODISCARD sync_wait_task
+    {
+      struct promise_type : promise_frame_allocation
+      {
+        sync_wait_state *state{nullptr};
+
+        sync_wait_task get_return_object() noexcept { return sync_wait_task{coroutine_handle<promise_type>::from_promise(*this)}; }
+        suspend_always initial_suspend() noexcept { return {}; }
+        auto final_suspend() noexcept
+        {
+          struct awaiter
+          {
+            bool await_ready() noexcept { return false; }
+            void await_resume() noexcept {}
+            void await_suspend(coroutine_handle<promise_type> self) noexcept
+            {
+              sync_wait_state *state = self.promise().state;
+              // Notify under the lock, as the waiter destroys the state as soon as it sees done
+              std::lock_guard<std::mutex> g(state->lock);
+              state->done = true;
+              state->cond.notify_all();
+            }
+          };
+          return awaiter{};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+      };
+      coroutine_handle<promise_type> _h;
+
+      explicit sync_wait_task(coroutine_handle<promise_type> h) noexcept
+          : _h(h)
+      {
+      }
+      sync_wait_task(sync_wait_task &&o) noexcept
+          : _h(o._h)
+      {
+        o._h = nullptr;
+      }
+      sync_wait_task(const sync_wait_task &) = delete;
+      sync_wait_task &operator=(sync_wait_task &&) = delete;
+      sync_wait_task &operator=(const sync_wait_task &) = delete;
+      ~sync_wait_task()
+      {
+        if(_h)
+        {
+          _h.destroy();
+        }
+      }
+    };
+    template <class Awaitable, class Cont> inline sync_wait_task sync_wait_run(Awaitable &a, combinator_slot<Cont> &slot) { slot.emplace(co_await a); }
+    template <class Awaitable> inline sync_wait_task sync_wait_run(Awaitable &a) { co_await a; }
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  class work_stealing_executor
+  {
+    struct worker
+    {
+      work_stealing_executor *owner{nullptr};
+      detail::work_stealing_deque deque;
+      uint32_t rand{0};
+      std::thread thread;
+    };
+
+    size_t _count{0};
+    std::unique_ptr<worker[]> _workers;
+    std::mutex _lock;
+    std::condition_variable _cond;
+    std::deque<coroutine_handle<>> _injected;  // protected by _lock
+    std::atomic<size_t> _injected_count{0};
+    std::atomic<uint64_t> _epoch{0};
+    std::atomic<size_t> _sleepers{0};
+    std::atomic<bool> _stopping{false};
+
+    static worker *&_current() noexcept
+    {
+      static thread_local worker *w;
+      return w;
+    }
+
+    void _notify()
+    {
+      _epoch.fetch_add(1, std::memory_order_seq_cst);
+      if(_sleepers.load(std::memory_order_seq_cst) > 0)
+      {
+        // Taking the lock orders this after any sleeper's check of the epoch
+        {
+          std::lock_guard<std::mutex> g(_lock);
+        }
+        _cond.notify_one();
+      }
+    }
+
+    coroutine_handle<> _find(worker &w)
+    {
+      if(void *p = w.deque.pop())
+      {
+        return coroutine_handle<>::from_address(p);
+      }
+      if(_injected_count.load(std::memory_order_relaxed) > 0)
+      {
+        std::lock_guard<std::mutex> g(_lock);
+        if(!_injected.empty())
+        {
+          coroutine_handle<> ret = _injected.front();
+          _injected.pop_front();
+          _injected_count.fetch_sub(1, std::memory_order_relaxed);
+          return ret;
+        }
+      }
+      // xorshift32 picks the first victim, so thieves don't all converge on the same one
+      w.rand ^= w.rand << 13U;
+      w.rand ^= w.rand >> 17U;
+      w.rand ^= w.rand << 5U;
+      const size_t first = w.rand % _count;
+      for(size_t n = 0; n < _count; n++)
+      {
+        worker &victim = _workers[(first + n) % _count];
+        if(&victim != &w)
+        {
+          if(void *p = victim.deque.steal())
+          {
+            return coroutine_handle<>::from_address(p);
+          }
+        }
+      }
+      return {};
+    }
+
+    void _run(worker &w)
+    {
+      _current() = &w;
+      for(;;)
+      {
+        coroutine_handle<> h = _find(w);
+        for(unsigned spin = 0; !h && spin < 64; spin++)
+        {
+          std::this_thread::yield();
+          h = _find(w);
+        }
+        if(h)
+        {
+          h.resume();
+          continue;
+        }
+        const uint64_t epoch = _epoch.load(std::memory_order_seq_cst);
+        h = _find(w);
+        if(h)
+        {
+          h.resume();
+          continue;
+        }
+        if(_stopping.load(std::memory_order_acquire))
+        {
+          break;
+        }
+        std::unique_lock<std::mutex> g(_lock);
+        _sleepers.fetch_add(1, std::memory_order_seq_cst);
+        _cond.wait(g, [&] { return _epoch.load(std::memory_order_seq_cst) != epoch || _stopping.load(std::memory_order_acquire); });
+        _sleepers.fetch_sub(1, std::memory_order_relaxed);
+      }
+      _current() = nullptr;
+    }
+
+  public:
+    //! The awaitable returned by `schedule()`.
+    struct schedule_awaitable
+    {
+      work_stealing_executor *executor;
+
+      bool await_ready() noexcept { return false; }
+      void await_suspend(coroutine_handle<> h) { executor->post(h); }
+      void await_resume() noexcept {}
+    };
+
+    //! Starts `threads` worker threads, by default one per hardware thread.
+    explicit work_stealing_executor(size_t threads = std::thread::hardware_concurrency())
+        : _count((threads > 0) ? threads : 1)
+        , _workers(new worker[_count])
+    {
+      for(size_t n = 0; n < _count; n++)
+      {
+        _workers[n].owner = this;
+        _workers[n].rand = static_cast<uint32_t>(n * 2654435761U + 1);
+      }
+      for(size_t n = 0; n < _count; n++)
+      {
+        _workers[n].thread = std::thread([this, n] { _run(_workers[n]); });
+      }
+    }
+    work_stealing_executor(const work_stealing_executor &) = delete;
+    work_stealing_executor &operator=(const work_stealing_executor &) = delete;
+    //! Joins the worker threads once they run out of work. Coroutines still suspended are not resumed.
+    ~work_stealing_executor()
+    {
+      _stopping.store(true, std::memory_order_release);
+      {
+        std::lock_guard<std::mutex> g(_lock);
+      }
+      _cond.notify_all();
+      for(size_t n = 0; n < _count; n++)
+      {
+        _workers[n].thread.join();
+      }
+    }
+
+    //! The number of worker threads.
+    size_t concurrency() const noexcept { return _count; }
+    //! True if the calling thread is one of this executor's workers.
+    bool running_in_this_thread() const noexcept { return _current() != nullptr && _current()->owner == this; }
+
+    /*! Queues `h` for resumption by a worker. From a worker of this executor it goes on that
+    worker's own deque, from where idle workers steal it, otherwise onto a shared queue.
+    */
+    void post(coroutine_handle<> h)
+    {
+      worker *w = _current();
+      if(w != nullptr && w->owner == this)
+      {
+        w->deque.push(h.address());
+      }
+      else
+      {
+        std::lock_guard<std::mutex> g(_lock);
+        _injected.push_back(h);
+        _injected_count.fetch_add(1, std::memory_order_relaxed);
+      }
+      _notify();
+    }
+
+    //! Returns an awaitable which resumes the awaiting coroutine on one of the worker threads.
+    schedule_awaitable schedule() noexcept { return schedule_awaitable{this}; }
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class Cont, bool suspend_initial, bool use_atomic)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_void<Cont>::value))
+  inline detail::awaitable<Cont, true, true> on(work_stealing_executor &executor, detail::awaitable<Cont, suspend_initial, use_atomic> child)
+  {
+    co_await executor.schedule();
+    co_return co_await child;
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class Cont, bool suspend_initial, bool use_atomic)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_void<Cont>::value))
+  inline detail::awaitable<void, true, true> on(work_stealing_executor &executor, detail::awaitable<Cont, suspend_initial, use_atomic> child)
+  {
+    co_await executor.schedule();
+    co_await child;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class Cont, bool suspend_initial, bool use_atomic)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_void<Cont>::value))
+  inline Cont sync_wait(detail::awaitable<Cont, suspend_initial, use_atomic> a)
+  {
+    detail::sync_wait_state state;
+    detail::combinator_slot<Cont> slot;
+    auto task = detail::sync_wait_run(a, slot);
+    task._h.promise().state = &state;
+    task._h.resume();
+    std::unique_lock<std::mutex> g(state.lock);
+    state.cond.wait(g, [&] { return state.done; });
+    return static_cast<Cont &&>(slot.result);
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class Cont, bool suspend_initial, bool use_atomic)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_void<Cont>::value))
+  inline void sync_wait(detail::awaitable<Cont, suspend_initial, use_atomic> a)
+  {
+    detail::sync_wait_state state;
+    auto task = detail::sync_wait_run(a);
+    task._h.promise().state = &state;
+    task._h.resume();
+    std::unique_lock<std::mutex> g(state.lock);
+    state.cond.wait(g, [&] { return state.done; });
+  }
+}  // namespace awaitables
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
+#endif
@@ -0,0 +1,330 @@
+/* An epoll reactor for Outcome's awaitables
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_COROUTINE_REACTOR_HPP
+#define OUTCOME_COROUTINE_REACTOR_HPP
+
+#include "coroutine_support.hpp"
+#include "result.hpp"
+
+#if defined(OUTCOME_FOUND_COROUTINE_HEADER) && defined(__linux__)
+
+#include <cerrno>
+#include <new>
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+namespace awaitables
+{
+  namespace detail
+  {
+    // A coroutine waiting for a file descriptor to become ready, living in its awaiter
+    struct reactor_waiter
+    {
+      coroutine_handle<> awaiting;
+      // Retries the operation, returning false if it would still block
+      bool (*perform)(reactor_waiter *) noexcept {nullptr};
+    };
+    struct reactor_fd_state
+    {
+      int fd{-1};
+      reactor_waiter *reader{nullptr};
+      reactor_waiter *writer{nullptr};
+    };
+
+    inline std::error_code reactor_errno(int code) noexcept { return std::error_code(code, std::generic_category()); }
+
+    struct reactor_read_call
+    {
+      void *buffer;
+      size_t bytes;
+
+      result<size_t> operator()(int fd) const noexcept
+      {
+        ssize_t ret;
+        do
+        {
+          ret = ::read(fd, buffer, bytes);
+        } while(-1 == ret && EINTR == errno);
+        if(-1 == ret)
+        {
+          return reactor_errno(errno);
+        }
+        return static_cast<size_t>(ret);
+      }
+    };
+    struct reactor_write_call
+    {
+      const void *buffer;
+      size_t bytes;
+
+      result<size_t> operator()(int fd) const noexcept
+      {
+        ssize_t ret;
+        do
+        {
+          ret = ::write(fd, buffer, bytes);
+        } while(-1 == ret && EINTR == errno);
+        if(-1 == ret)
+        {
+          return reactor_errno(errno);
+        }
+        return static_cast<size_t>(ret);
+      }
+    };
+    struct reactor_accept_call
+    {
+      result<int> operator()(int fd) const noexcept
+      {
+        int ret;
+        do
+        {
+          ret = ::accept4(fd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        } while(-1 == ret && EINTR == errno);
+        if(-1 == ret)
+        {
+          return reactor_errno(errno);
+        }
+        return ret;
+      }
+    };
+
+    /* Each operation is first attempted immediately, and only if it would block is the awaiting
+    coroutine suspended, with this awaiter registered on the file descriptor. The reactor retries
+    the operation when epoll reports readiness, and resumes the coroutine once it no longer
+    blocks, so the result is always complete by the time the coroutine is resumed.
+    */
+    template <class T, class Call, bool is_write> class OUTCOME_NODISCARD reactor_awaitable : reactor_waiter
+    {
+      reactor_fd_state *_state;
+      Call _call;
+      result<T> _result{T{}};
+
+      bool _attempt() noexcept
+      {
+        _result = _call(_state->fd);
+        return !(_result.has_error() && (_result.error().value() == EAGAIN || _result.error().value() == EWOULDBLOCK));
+      }
+      static bool _perform(reactor_waiter *w) noexcept { return static_cast<reactor_awaitable *>(w)->_attempt(); }
+
+    public:
+      reactor_awaitable(reactor_fd_state *state, Call call) noexcept
+          : _state(state)
+          , _call(call)
+      {
+      }
+      reactor_awaitable(const reactor_awaitable &) = delete;
+      reactor_awaitable &operator=(const reactor_awaitable &) = delete;
+
+      bool await_ready() noexcept { return _attempt(); }
+      void await_suspend(coroutine_handle<> h) noexcept
+      {
+        reactor_waiter *&slot = is_write ? _state->writer : _state->reader;
+        assert(slot == nullptr);  // one reader and one writer at a time
+        awaiting = h;
+        perform = &_perform;
+        slot = this;
+      }
+      result<T> await_resume() noexcept { return static_cast<result<T> &&>(_result); }
+    };
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  class async_fd
+  {
+    friend class epoll_reactor;
+    int _epoll{-1};
+    detail::reactor_fd_state *_state{nullptr};
+
+    async_fd(int epoll, detail::reactor_fd_state *state) noexcept
+        : _epoll(epoll)
+        , _state(state)
+    {
+    }
+
+  public:
+    async_fd() = default;
+    async_fd(async_fd &&o) noexcept
+        : _epoll(o._epoll)
+        , _state(o._state)
+    {
+      o._state = nullptr;
+    }
+    async_fd(const async_fd &) = delete;
+    async_fd &operator=(async_fd &&o) noexcept
+    {
+      async_fd temp(static_cast<async_fd &&>(o));
+      const int epoll = _epoll;
+      detail::reactor_fd_state *state = _state;
+      _epoll = temp._epoll;
+      _state = temp._state;
+      temp._epoll = epoll;
+      temp._state = state;
+      return *this;
+    }
+    async_fd &operator=(const async_fd &) = delete;
+    //! Deregisters and closes the file descriptor. No operation may be outstanding.
+    ~async_fd()
+    {
+      if(_state != nullptr)
+      {
+        assert(_state->reader == nullptr && _state->writer == nullptr);
+        ::epoll_ctl(_epoll, EPOLL_CTL_DEL, _state->fd, nullptr);
+        ::close(_state->fd);
+        delete _state;
+        _state = nullptr;
+      }
+    }
+
+    //! The file descriptor.
+    int native_handle() const noexcept { return (_state != nullptr) ? _state->fd : -1; }
+
+    //! Returns an awaitable reading up to `bytes` into `buffer`, yielding `result<size_t>` with the count read, zero at end of file.
+    detail::reactor_awaitable<size_t, detail::reactor_read_call, false> read(void *buffer, size_t bytes) noexcept { return {_state, {buffer, bytes}}; }
+    //! Returns an awaitable writing up to `bytes` from `buffer`, yielding `result<size_t>` with the count written.
+    detail::reactor_awaitable<size_t, detail::reactor_write_call, true> write(const void *buffer, size_t bytes) noexcept { return {_state, {buffer, bytes}}; }
+    //! Returns an awaitable accepting a connection on a listening socket, yielding `result<int>` with the new non-blocking socket.
+    detail::reactor_awaitable<int, detail::reactor_accept_call, false> accept() noexcept { return {_state, {}}; }
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  class epoll_reactor
+  {
+    int _epoll{-1};
+
+    explicit epoll_reactor(int epoll) noexcept
+        : _epoll(epoll)
+    {
+    }
+
+  public:
+    //! The most events retrieved from the kernel per call to `run_once()`.
+    static constexpr int max_events = 64;
+
+    //! Creates a reactor, failing with the error from `epoll_create1()`.
+    static result<epoll_reactor> create() noexcept
+    {
+      const int fd = ::epoll_create1(EPOLL_CLOEXEC);
+      if(-1 == fd)
+      {
+        return detail::reactor_errno(errno);
+      }
+      return epoll_reactor(fd);
+    }
+    epoll_reactor(epoll_reactor &&o) noexcept
+        : _epoll(o._epoll)
+    {
+      o._epoll = -1;
+    }
+    epoll_reactor(const epoll_reactor &) = delete;
+    epoll_reactor &operator=(epoll_reactor &&) = delete;
+    epoll_reactor &operator=(const epoll_reactor &) = delete;
+    //! Every `async_fd` attached must be destroyed first.
+    ~epoll_reactor()
+    {
+      if(_epoll != -1)
+      {
+        ::close(_epoll);
+      }
+    }
+
+    /*! Takes ownership of the non-blocking file descriptor `fd`, registering it edge triggered for
+    both reading and writing. This allocates once for the lifetime of the registration, so that no
+    operation on it ever allocates. If registration fails, `fd` is not closed.
+    */
+    result<async_fd> attach(int fd) noexcept
+    {
+      auto *state = new(std::nothrow) detail::reactor_fd_state;
+      if(state == nullptr)
+      {
+        return std::errc::not_enough_memory;
+      }
+      state->fd = fd;
+      epoll_event ev{};
+      ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+      ev.data.ptr = state;
+      if(-1 == ::epoll_ctl(_epoll, EPOLL_CTL_ADD, fd, &ev))
+      {
+        const int code = errno;
+        delete state;
+        return detail::reactor_errno(code);
+      }
+      return async_fd(_epoll, state);
+    }
+
+    /*! Waits up to `timeout_ms` milliseconds, forever if negative, for file descriptors to become
+    ready. The waiting operations which can now complete are completed, and their coroutines are
+    resumed by the calling thread. Returns the number of coroutines resumed. Operations may only be
+    awaited on the thread which calls this.
+    */
+    result<size_t> run_once(int timeout_ms = -1) noexcept
+    {
+      epoll_event events[max_events];
+      int count;
+      do
+      {
+        count = ::epoll_wait(_epoll, events, max_events, timeout_ms);
+      } while(-1 == count && EINTR == errno);
+      if(-1 == count)
+      {
+        return detail::reactor_errno(errno);
+      }
+      // Complete everything before resuming anything, as a resumed coroutine may destroy an async_fd
+      detail::reactor_waiter *ready[max_events * 2];
+      size_t readied = 0;
+      for(int n = 0; n < count; n++)
+      {
+        auto *state = static_cast<detail::reactor_fd_state *>(events[n].data.ptr);
+        const uint32_t what = events[n].events;
+        if(state->reader != nullptr && (what & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0 && state->reader->perform(state->reader))
+        {
+          ready[readied++] = state->reader;
+          state->reader = nullptr;
+        }
+        if(state->writer != nullptr && (what & (EPOLLOUT | EPOLLHUP | EPOLLERR)) != 0 && state->writer->perform(state->writer))
+        {
+          ready[readied++] = state->writer;
+          state->writer = nullptr;
+        }
+      }
+      for(size_t n = 0; n < readied; n++)
+      {
+        ready[n]->awaiting.resume();
+      }
+      return readied;
+    }
+  };
+}  // namespace awaitables
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
+#endif
@@ -0,0 +1,389 @@
+/* A structured concurrency task group for Outcome's awaitables
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_COROUTINE_TASK_GROUP_HPP
+#define OUTCOME_COROUTINE_TASK_GROUP_HPP
+
+#include "coroutine_support.hpp"
+
+#if defined(OUTCOME_FOUND_COROUTINE_HEADER) && OUTCOME_HAVE_STOP_TOKEN
+
+#include <cstdint>
+#include <memory>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+namespace awaitables
+{
+  namespace detail
+  {
+    /* A monotonic arena for coroutine frames. Allocation bumps a pointer, freeing a frame within
+    the arena does nothing, and the whole arena is reclaimed at once by reset(). Should the arena
+    run out, frames are allocated from the heap instead, and freed back to it.
+    */
+    class frame_arena
+    {
+      std::unique_ptr<std::max_align_t[]> _storage;
+      char *_begin{nullptr}, *_next{nullptr}, *_end{nullptr};
+
+      bool _contains(void *p) const noexcept
+      {
+        return reinterpret_cast<uintptr_t>(p) >= reinterpret_cast<uintptr_t>(_begin) && reinterpret_cast<uintptr_t>(p) < reinterpret_cast<uintptr_t>(_end);
+      }
+
+    public:
+      explicit frame_arena(size_t bytes)
+          : _storage(new std::max_align_t[(bytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)])
+          , _begin(reinterpret_cast<char *>(_storage.get()))
+          , _next(_begin)
+          , _end(_begin + (bytes + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t) * sizeof(std::max_align_t))
+      {
+      }
+
+      void *allocate(size_t bytes, size_t align)
+      {
+        char *p = reinterpret_cast<char *>((reinterpret_cast<uintptr_t>(_next) + align - 1) & ~static_cast<uintptr_t>(align - 1));
+        if(bytes <= static_cast<size_t>(_end - p))
+        {
+          _next = p + bytes;
+          return p;
+        }
+        return ::operator new(bytes);
+      }
+      void deallocate(void *p) noexcept
+      {
+        if(!_contains(p))
+        {
+          ::operator delete(p);
+        }
+      }
+      //! Reclaims the arena. No frame within it may still be alive.
+      void reset() noexcept { _next = _begin; }
+      //! The bytes of the arena in use.
+      size_t used() const noexcept { return static_cast<size_t>(_next - _begin); }
+    };
+
+    template <class T> struct frame_arena_allocator
+    {
+      using value_type = T;
+      frame_arena *arena;
+
+      explicit frame_arena_allocator(frame_arena *a) noexcept
+          : arena(a)
+      {
+      }
+      template <class U>
+      frame_arena_allocator(const frame_arena_allocator<U> &o) noexcept
+          : arena(o.arena)
+      {
+      }
+      T *allocate(size_t n) { return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T))); }
+      void deallocate(T *p, size_t /*unused*/) noexcept { arena->deallocate(p); }
+      template <class U> bool operator==(const frame_arena_allocator<U> &o) const noexcept { return arena == o.arena; }
+      template <class U> bool operator!=(const frame_arena_allocator<U> &o) const noexcept { return arena != o.arena; }
+    };
+
+    // A coroutine which never completes, resumed each time a child of a task group completes
+    struct OUTCOME_NODISCARD group_notifier
+    {
+      struct promise_type : promise_frame_allocation
+      {
+        group_notifier get_return_object() noexcept { return group_notifier{coroutine_handle<promise_type>::from_promise(*this)}; }
+        suspend_always initial_suspend() noexcept { return {}; }
+        suspend_always final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+      };
+      coroutine_handle<promise_type> _h;
+
+      group_notifier() = default;
+      explicit group_notifier(coroutine_handle<promise_type> h) noexcept
+          : _h(h)
+      {
+      }
+      group_notifier(group_notifier &&o) noexcept
+          : _h(o._h)
+      {
+        o._h = nullptr;
+      }
+      group_notifier(const group_notifier &) = delete;
+      group_notifier &operator=(group_notifier &&) = delete;
+      group_notifier &operator=(const group_notifier &) = delete;
+      ~group_notifier()
+      {
+        if(_h)
+        {
+          _h.destroy();
+        }
+      }
+    };
+
+    // Resumes the combining coroutine if this was the last to complete
+    struct group_done_awaiter
+    {
+      combinator_state *state;
+
+      bool await_ready() noexcept { return false; }
+      void await_resume() noexcept {}
+#if OUTCOME_HAVE_NOOP_COROUTINE
+      coroutine_handle<> await_suspend(coroutine_handle<> /*unused*/) noexcept { return state->done() ? state->parent : noop_coroutine(); }
+#else
+      void await_suspend(coroutine_handle<> /*unused*/)
+      {
+        if(state->done())
+        {
+          state->parent.resume();
+        }
+      }
+#endif
+    };
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class Cont> class task_group
+  {
+    static_assert(OUTCOME_V2_NAMESPACE::is_basic_result<Cont>::value, "task_group<T> requires T to be a basic_result");
+    static_assert(std::is_constructible<Cont, std::errc>::value, "task_group<T> requires T to be constructible from errc::operation_canceled");
+
+  public:
+    using container_type = Cont;
+    using value_type = typename Cont::value_type;
+    using error_type = typename Cont::error_type;
+    using status_type = basic_result<void, error_type, typename detail::rebind_no_value_policy<typename Cont::no_value_policy_type, void>::type>;
+    using allocator_type = detail::frame_arena_allocator<char>;
+
+  private:
+    using stored_type = std::conditional_t<std::is_void<value_type>::value, char, value_type>;
+    struct value_storage
+    {
+      alignas(stored_type) unsigned char bytes[sizeof(stored_type)];
+    };
+
+    /* Each child is started by resuming its frame directly, having been given the continuation
+    of its slot's notifier, a coroutine made once per slot when the group is constructed, and a
+    pointer to the group's stop token. When the child completes it transfers to the notifier,
+    which takes its result and counts it down in the combinator_state shared by all children, as
+    in when_all(), where the first to fail decides. So spawning creates no frame but the child's,
+    and copies no stop token. A child costs about 40 to 45 ns through the group on GCC 12 -O2,
+    against about 25 ns awaited directly, see benchmark/micro_task_group.cpp.
+    */
+    struct child_slot
+    {
+      detail::group_notifier notifier;
+      coroutine_handle<> child;
+      Cont *result{nullptr};
+    };
+    size_t _capacity;
+    size_t _count{0};
+    detail::frame_arena _arena;
+    std::unique_ptr<child_slot[]> _children;
+    std::unique_ptr<value_storage[]> _values;
+    std::unique_ptr<bool[]> _constructed;
+    detail::combinator_state _state;
+    detail::combinator_slot<Cont> _failure;
+
+    value_type *_value_at(size_t idx) noexcept { return reinterpret_cast<value_type *>(&_values[idx]); }
+
+    void _complete(size_t idx, Cont &&r)
+    {
+      if(r.has_value())
+      {
+        if constexpr(!std::is_void<value_type>::value)
+        {
+          new(_value_at(idx)) value_type(static_cast<Cont &&>(r).assume_value());
+          _constructed[idx] = true;
+        }
+        return;
+      }
+      if(_state.decide(idx))
+      {
+        _failure.emplace(static_cast<Cont &&>(r));
+      }
+    }
+
+    static detail::group_notifier _notify(task_group *self, size_t idx)
+    {
+      for(;;)
+      {
+        self->_complete(idx, static_cast<Cont &&>(*self->_children[idx].result));
+        co_await detail::group_done_awaiter{&self->_state};
+      }
+    }
+
+    // Starts each child in turn, skipping those not yet started once one has failed
+    struct start_awaiter
+    {
+      task_group *self;
+
+      bool await_ready() noexcept { return false; }
+      void await_resume() noexcept {}
+      template <class Promise> bool await_suspend(coroutine_handle<Promise> parent)
+      {
+        detail::combinator_state &state = self->_state;
+        const size_t count = self->_count;
+        state.parent = parent;
+        state.countdown.store(count + 1, std::memory_order_relaxed);
+        for(size_t n = 0; n < count; n++)
+        {
+          if(state.decided())
+          {
+            state.countdown.fetch_sub(1, std::memory_order_relaxed);
+            continue;
+          }
+          if(state._token.stop_requested())
+          {
+            // As a child awaited once stop is requested, it completes cancelled without being started
+            self->_complete(n, Cont(std::errc::operation_canceled));
+            state.countdown.fetch_sub(1, std::memory_order_relaxed);
+            continue;
+          }
+          self->_children[n].child.resume();
+        }
+        return !state.done();
+      }
+    };
+
+  public:
+    //! The arena bytes reserved per child if not specified.
+    static constexpr size_t default_arena_bytes_per_child = 512;
+
+    /*! Preallocates room for up to `capacity` children and their values, and an arena of
+    `arena_bytes_per_child` times `capacity` bytes for their coroutine frames.
+    */
+    explicit task_group(size_t capacity, size_t arena_bytes_per_child = default_arena_bytes_per_child)
+        : _capacity(capacity)
+        , _arena(capacity * arena_bytes_per_child)
+        , _children(new child_slot[capacity])
+        , _values(std::is_void<value_type>::value ? nullptr : new value_storage[capacity])
+        , _constructed(new bool[capacity]())
+    {
+      for(size_t n = 0; n < capacity; n++)
+      {
+        detail::group_notifier t = _notify(this, n);
+        _children[n].notifier._h = t._h;
+        t._h = nullptr;
+      }
+    }
+    task_group(const task_group &) = delete;
+    task_group(task_group &&) = delete;
+    task_group &operator=(const task_group &) = delete;
+    task_group &operator=(task_group &&) = delete;
+    //! Destroys all children, which must not be running.
+    ~task_group() { reset(); }
+
+    //! The most children which can be spawned before `reset()`.
+    size_t capacity() const noexcept { return _capacity; }
+    //! The number of children spawned.
+    size_t size() const noexcept { return _count; }
+    //! The bytes of the frame arena in use.
+    size_t arena_used() const noexcept { return _arena.used(); }
+
+    /*! An allocator from the group's frame arena. A child coroutine whose parameters begin with
+    `(std::allocator_arg_t, allocator_type)` has its frame allocated from the arena.
+    */
+    allocator_type get_allocator() noexcept { return allocator_type(&_arena); }
+
+    /*! Adds the lazy `child`, to be started by `join()`. Fails with `errc::no_buffer_space` if
+    the group is at capacity.
+    */
+    template <bool use_atomic> status_type spawn(detail::awaitable<Cont, true, use_atomic> child)
+    {
+      if(_count == _capacity)
+      {
+        return status_type{std::errc::no_buffer_space};
+      }
+      child_slot &slot = _children[_count++];
+      auto &p = child._h.promise();
+      p.continuation = slot.notifier._h;
+      p.stop_token = &_state._token;
+      slot.result = &p.result;
+      slot.child = child._h;
+      child._h = nullptr;
+      return status_type{in_place_type<void>};
+    }
+
+    /*! Returns a lazy awaitable which starts every child spawned and completes once all have
+    completed. On the first failure stop is requested of every child, those not yet started are
+    never started, and that failure is the result. Cancellation of the awaiting coroutine passes
+    on to the children. The group may only be joined once between resets.
+    */
+    detail::awaitable<status_type, true, true> join()
+    {
+      std::stop_callback<detail::forward_stop> forward(co_await get_stop_token(), detail::forward_stop{&_state._source});
+      co_await start_awaiter{this};
+      if(_state.decided())
+      {
+        co_return static_cast<Cont &&>(_failure.result).as_failure();
+      }
+      co_return status_type{in_place_type<void>};
+    }
+
+    //! The value of each child in the order spawned, after a successful `join()`.
+    value_type *values() noexcept
+    {
+      static_assert(!std::is_void<value_type>::value, "task_group<T>::values() requires a non-void value type");
+      return _value_at(0);
+    }
+
+    //! Destroys all children and their values, and reclaims the frame arena. No child may be running.
+    void reset() noexcept
+    {
+      for(size_t n = 0; n < _count; n++)
+      {
+        if(_children[n].child)
+        {
+          _children[n].child.destroy();
+          _children[n].child = nullptr;
+        }
+        if constexpr(!std::is_void<value_type>::value)
+        {
+          if(_constructed[n])
+          {
+            _value_at(n)->~value_type();
+            _constructed[n] = false;
+          }
+        }
+      }
+      if(_failure.set)
+      {
+        _failure.result.~Cont();
+        _failure.set = false;
+      }
+      _count = 0;
+      _arena.reset();
+      _state.decided_by.store(detail::combinator_state::undecided, std::memory_order_relaxed);
+      if(_state._source.stop_requested())
+      {
+        _state._source = std::stop_source();
+        _state._token = _state._source.get_token();
+      }
+    }
+  };
+}  // namespace awaitables
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
+#endif
@@ -0,0 +1,353 @@
+/* A timer wheel and deadlines for Outcome's awaitables
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_COROUTINE_TIMER_HPP
+#define OUTCOME_COROUTINE_TIMER_HPP
+
+#include "coroutine_support.hpp"
+
+#if defined(OUTCOME_FOUND_COROUTINE_HEADER) && OUTCOME_HAVE_STOP_TOKEN
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+namespace awaitables
+{
+  namespace detail
+  {
+    // A timer linked into a slot of a timer_wheel. The state is protected by the timer_service's lock.
+    struct wheel_timer
+    {
+      enum state_type
+      {
+        idle,
+        pending,
+        firing,
+        fired
+      };
+      wheel_timer *prev{this}, *next{this};
+      uint64_t expiry{0};
+      void (*fire)(wheel_timer *) noexcept {nullptr};
+      state_type state{idle};
+
+      wheel_timer() = default;
+      wheel_timer(const wheel_timer &) = delete;
+      wheel_timer &operator=(const wheel_timer &) = delete;
+
+      bool linked() const noexcept { return next != this; }
+      void link_before(wheel_timer *t) noexcept
+      {
+        t->prev = prev;
+        t->next = this;
+        prev->next = t;
+        prev = t;
+      }
+      void unlink() noexcept
+      {
+        prev->next = next;
+        next->prev = prev;
+        prev = next = this;
+      }
+    };
+
+    /* A hierarchical timing wheel after Varghese and Lauck, of four levels of 64 slots, each
+    level spanning 64 times the ticks of the one below. A timer is placed in the lowest level
+    whose span covers the ticks until it expires. Whenever a level wraps around, the timers in
+    the next slot of the level above are redistributed into lower levels, so each timer is
+    moved at most three times before it expires. Adding and removing a timer is O(1).
+    */
+    class timer_wheel
+    {
+    public:
+      static constexpr unsigned level_bits = 6;
+      static constexpr unsigned levels = 4;
+      static constexpr unsigned slots = 1U << level_bits;
+
+    private:
+      wheel_timer _slots[levels][slots];  // sentinels of circular lists
+      uint64_t _now{0};
+      size_t _count{0};
+
+      static constexpr uint64_t _span(unsigned level) noexcept { return uint64_t(1) << (level_bits * level); }
+
+      void _place(wheel_timer *t) noexcept
+      {
+        const uint64_t delta = t->expiry - _now;
+        unsigned level = 0;
+        while(level < levels - 1 && delta >= _span(level + 1))
+        {
+          ++level;
+        }
+        // Timers beyond the span of the top level are parked in its furthest slot, and re-placed from there
+        const uint64_t at = (delta >= _span(levels)) ? _now + _span(levels) - 1 : t->expiry;
+        _slots[level][(at >> (level_bits * level)) & (slots - 1)].link_before(t);
+      }
+      void _cascade(unsigned level) noexcept
+      {
+        wheel_timer &list = _slots[level][(_now >> (level_bits * level)) & (slots - 1)];
+        while(list.linked())
+        {
+          wheel_timer *t = list.next;
+          t->unlink();
+          _place(t);
+        }
+      }
+
+    public:
+      timer_wheel() = default;
+      timer_wheel(const timer_wheel &) = delete;
+      timer_wheel &operator=(const timer_wheel &) = delete;
+
+      //! The current tick.
+      uint64_t now() const noexcept { return _now; }
+      //! The number of timers in the wheel.
+      size_t size() const noexcept { return _count; }
+
+      //! Adds `t` to expire at tick `t->expiry`, or at the next tick if that has passed.
+      void add(wheel_timer *t) noexcept
+      {
+        if(t->expiry <= _now)
+        {
+          t->expiry = _now + 1;
+        }
+        _place(t);
+        ++_count;
+      }
+      //! Removes `t`, which must be in the wheel.
+      void remove(wheel_timer *t) noexcept
+      {
+        t->unlink();
+        --_count;
+      }
+
+      //! Advances to tick `target`, appending the timers which expire to `expired`.
+      void advance(uint64_t target, wheel_timer &expired) noexcept
+      {
+        if(_count == 0)
+        {
+          _now = (target > _now) ? target : _now;
+          return;
+        }
+        while(_now < target)
+        {
+          ++_now;
+          unsigned top = 0;
+          while(top < levels - 1 && (_now & (_span(top + 1) - 1)) == 0)
+          {
+            ++top;
+          }
+          // Higher levels first, as they may cascade into the slot of the level below due now
+          for(unsigned level = top; level > 0; level--)
+          {
+            _cascade(level);
+          }
+          wheel_timer &list = _slots[0][_now & (slots - 1)];
+          while(list.linked())
+          {
+            wheel_timer *t = list.next;
+            t->unlink();
+            expired.link_before(t);
+            --_count;
+          }
+        }
+      }
+      //! A tick no later than the next at which a timer may expire, if any timers remain.
+      uint64_t next_due() const noexcept
+      {
+        const uint64_t wrap = (_now | (slots - 1)) + 1;
+        for(uint64_t tick = _now + 1; tick < wrap; tick++)
+        {
+          if(_slots[0][tick & (slots - 1)].linked())
+          {
+            return tick;
+          }
+        }
+        return wrap;
+      }
+    };
+
+    // Requests stop of a stop_source when it fires
+    struct deadline_timer : wheel_timer
+    {
+      std::stop_source *source;
+
+      explicit deadline_timer(std::stop_source *s) noexcept
+          : source(s)
+      {
+        fire = [](wheel_timer *t) noexcept { static_cast<deadline_timer *>(t)->source->request_stop(); };
+      }
+    };
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  class timer_service
+  {
+    using clock = std::chrono::steady_clock;
+
+    std::chrono::nanoseconds _resolution;
+    clock::time_point _epoch;
+    std::mutex _lock;
+    std::condition_variable _cond;        // wakes the timer thread
+    std::condition_variable _fired_cond;  // wakes cancellers waiting for a timer to finish firing
+    detail::timer_wheel _wheel;           // protected by _lock
+    uint64_t _sleeping_until{UINT64_MAX};  // protected by _lock
+    bool _stopping{false};                 // protected by _lock
+    std::thread _thread;
+
+    uint64_t _tick_of(clock::time_point t) const noexcept { return static_cast<uint64_t>((t - _epoch) / _resolution); }
+
+    void _run()
+    {
+      std::unique_lock<std::mutex> g(_lock);
+      while(!_stopping)
+      {
+        detail::wheel_timer expired;
+        _wheel.advance(_tick_of(clock::now()), expired);
+        if(expired.linked())
+        {
+          for(detail::wheel_timer *t = expired.next; t != &expired; t = t->next)
+          {
+            t->state = detail::wheel_timer::firing;
+          }
+          // Fire without the lock, so firing may add and cancel timers. Until marked fired, the
+          // owner of a timer waits in cancel() rather than destroying it.
+          g.unlock();
+          for(detail::wheel_timer *t = expired.next; t != &expired; t = t->next)
+          {
+            t->fire(t);
+          }
+          g.lock();
+          while(expired.linked())
+          {
+            detail::wheel_timer *t = expired.next;
+            t->unlink();
+            t->state = detail::wheel_timer::fired;
+          }
+          _fired_cond.notify_all();
+          continue;
+        }
+        if(_wheel.size() == 0)
+        {
+          _sleeping_until = UINT64_MAX;
+          _cond.wait(g);
+        }
+        else
+        {
+          _sleeping_until = _wheel.next_due();
+          _cond.wait_until(g, _epoch + _resolution * _sleeping_until);
+        }
+        _sleeping_until = 0;
+      }
+    }
+
+  public:
+    //! Starts the thread servicing timers, which expire on multiples of `resolution`.
+    explicit timer_service(std::chrono::nanoseconds resolution = std::chrono::milliseconds(1))
+        : _resolution(resolution)
+        , _epoch(clock::now())
+        , _thread([this] { _run(); })
+    {
+    }
+    timer_service(const timer_service &) = delete;
+    timer_service &operator=(const timer_service &) = delete;
+    //! Stops and joins the timer thread. Timers still pending never fire, and must not be cancelled after.
+    ~timer_service()
+    {
+      {
+        std::lock_guard<std::mutex> g(_lock);
+        _stopping = true;
+      }
+      _cond.notify_one();
+      _thread.join();
+    }
+
+    //! The length of a tick.
+    std::chrono::nanoseconds resolution() const noexcept { return _resolution; }
+
+    //! Arranges for `t` to fire on the timer thread once `timeout` has passed, rounded up to the next tick.
+    void schedule(detail::wheel_timer &t, std::chrono::nanoseconds timeout)
+    {
+      const uint64_t expiry = _tick_of(clock::now() + timeout + _resolution - std::chrono::nanoseconds(1));
+      bool wake;
+      {
+        std::lock_guard<std::mutex> g(_lock);
+        assert(t.state != detail::wheel_timer::pending && t.state != detail::wheel_timer::firing);
+        t.expiry = expiry;
+        t.state = detail::wheel_timer::pending;
+        _wheel.add(&t);
+        wake = t.expiry < _sleeping_until;
+      }
+      if(wake)
+      {
+        _cond.notify_one();
+      }
+    }
+    //! Cancels `t` if it has not fired, otherwise waits for it to finish firing. Returns true if it fired.
+    bool cancel(detail::wheel_timer &t)
+    {
+      std::unique_lock<std::mutex> g(_lock);
+      if(t.state == detail::wheel_timer::pending)
+      {
+        _wheel.remove(&t);
+        t.state = detail::wheel_timer::idle;
+        return false;
+      }
+      _fired_cond.wait(g, [&] { return t.state != detail::wheel_timer::firing; });
+      return t.state == detail::wheel_timer::fired;
+    }
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class Cont, bool use_atomic, class Rep, class Period)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_constructible<Cont, std::errc>::value))
+  inline detail::awaitable<Cont, true, use_atomic> with_deadline(timer_service &service, detail::awaitable<Cont, true, use_atomic> child,
+                                                                 std::chrono::duration<Rep, Period> timeout)
+  {
+    std::stop_source source;
+    std::stop_callback<detail::forward_stop> forward(co_await get_stop_token(), detail::forward_stop{&source});
+    detail::deadline_timer timer(&source);
+    service.schedule(timer, std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+    child.set_stop_token(source.get_token());
+    Cont r = co_await child;
+    // The deadline may pass after the child has already completed, in which case its result stands
+    if(service.cancel(timer) && r.has_error() && r.error() == std::errc::operation_canceled)
+    {
+      co_return std::errc::timed_out;
+    }
+    co_return r;
+  }
+}  // namespace awaitables
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
+#endif
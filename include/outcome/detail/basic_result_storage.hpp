@@ -147,6 +147,7 @@ namespace detail
         : _state(o._state._status.have_value() ? _state_type(in_place_type<_value_type>, o._state._value) :
                                                  _state_type(in_place_type<_error_type>, make_error_code(o._state._error)))
     {
+      _state._status.spare_storage_value = o._state._status.spare_storage_value;
     }
     template <class T, class U, class V>
     constexpr basic_result_storage(make_error_code_compatible_conversion_tag /*unused*/, basic_result_storage<T, U, V> &&o) noexcept(
@@ -154,6 +155,7 @@ namespace detail
         : _state(o._state._status.have_value() ? _state_type(in_place_type<_value_type>, static_cast<T &&>(o._state._value)) :
                                                  _state_type(in_place_type<_error_type>, make_error_code(static_cast<U &&>(o._state._error))))
     {
+      _state._status.spare_storage_value = o._state._status.spare_storage_value;
     }
 
     struct make_exception_ptr_compatible_conversion_tag
@@ -165,6 +167,7 @@ namespace detail
         : _state(o._state._status.have_value() ? _state_type(in_place_type<_value_type>, o._state._value) :
                                                  _state_type(in_place_type<_error_type>, make_exception_ptr(o._state._error)))
     {
+      _state._status.spare_storage_value = o._state._status.spare_storage_value;
     }
     template <class T, class U, class V>
     constexpr basic_result_storage(make_exception_ptr_compatible_conversion_tag /*unused*/, basic_result_storage<T, U, V> &&o) noexcept(
@@ -172,6 +175,7 @@ namespace detail
         : _state(o._state._status.have_value() ? _state_type(in_place_type<_value_type>, static_cast<T &&>(o._state._value)) :
                                                  _state_type(in_place_type<_error_type>, make_exception_ptr(static_cast<U &&>(o._state._error))))
     {
+      _state._status.spare_storage_value = o._state._status.spare_storage_value;
     }
   };
 
@@ -29,8 +29,20 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef OUTCOME_DETAIL_COROUTINE_SUPPORT_HPP
 #define OUTCOME_DETAIL_COROUTINE_SUPPORT_HPP
 
+#include "../basic_result.hpp"
+
 #include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <utility>
+
+#ifndef OUTCOME_COROUTINE_RECYCLE_FRAMES
+#define OUTCOME_COROUTINE_RECYCLE_FRAMES 1
+#endif
 
 #if __cpp_impl_coroutine || (defined(_MSC_VER) && __cpp_coroutines) || (defined(__clang__) && __cpp_coroutines)
 #ifndef OUTCOME_HAVE_NOOP_COROUTINE
@@ -78,6 +90,16 @@ namespace awaitables
 OUTCOME_V2_NAMESPACE_END
 #define OUTCOME_FOUND_COROUTINE_HEADER 1
 #endif
+#if defined(OUTCOME_FOUND_COROUTINE_HEADER) && !defined(OUTCOME_HAVE_STOP_TOKEN)
+#if __has_include(<stop_token>)
+#include <stop_token>
+#endif
+#if __cpp_lib_jthread >= 201911L
+#define OUTCOME_HAVE_STOP_TOKEN 1
+#else
+#define OUTCOME_HAVE_STOP_TOKEN 0
+#endif
+#endif
 #endif
 
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
@@ -112,24 +134,252 @@ namespace awaitables
     OUTCOME_TREQUIRES(OUTCOME_TPRED(OUTCOME_V2_NAMESPACE::detail::is_constructible<U, T>))
     inline void set_or_rethrow(T &e, U *result) { new(result) U(e); }
     template <class T> inline void set_or_rethrow(T &e, ...) { rethrow_exception(e); }
-    template <class T> class fake_atomic
+    OUTCOME_TEMPLATE(class U)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_constructible<U, std::errc>::value))
+    inline bool try_set_cancelled(U *result)
     {
-      T _v;
+      new(result) U(std::errc::operation_canceled);
+      return true;
+    }
+    inline bool try_set_cancelled(...) { return false; }
+    // Whether a promise has its result. Only awaitables which may complete on another thread need
+    // this to be atomic, the others keep a plain bool.
+    inline bool result_is_set(const std::atomic<bool> &v) noexcept { return v.load(std::memory_order_acquire); }
+    inline bool result_is_set(bool v) noexcept { return v; }
+    inline void mark_result_set(std::atomic<bool> &v) noexcept { v.store(true, std::memory_order_release); }
+    inline void mark_result_set(bool &v) noexcept { v = true; }
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+    /* Coroutine frames are recycled through per-thread free lists bucketed by size. A frame
+    destroyed on a thread other than the one which allocated it is pushed onto a lock free
+    stack belonging to the allocating thread, which drains it when its own list runs dry.
 
+    A thread's cache outlives the thread if frames it allocated are still alive. The owning
+    thread counts frames allocated minus frames it freed, other threads decrement a shared
+    balance after pushing, and at thread exit the owner adds its count to the balance.
+    Whoever brings the balance to zero deletes the cache.
+    */
+    class frame_cache
+    {
     public:
-      constexpr fake_atomic(T v)
-          : _v(v)
+      struct alignas(std::max_align_t) header
+      {
+        union
+        {
+          frame_cache *owner;
+          void (*release)(header *, size_t) noexcept;
+        };
+        unsigned bucket;
+      };
+      static constexpr unsigned buckets = 5;
+      static constexpr unsigned uncached_bucket = buckets;
+      static constexpr unsigned allocator_bucket = buckets + 1;
+      static constexpr size_t smallest_block = 128;
+      static constexpr size_t max_cached_per_bucket = 64;
+
+    private:
+      header *_local[buckets]{};
+      size_t _local_count[buckets]{};
+      ptrdiff_t _outstanding{0};
+      std::atomic<header *> _remote{nullptr};
+      std::atomic<ptrdiff_t> _balance{0};
+
+      struct thread_holder
+      {
+        frame_cache *cache{new frame_cache};
+        thread_holder() = default;
+        thread_holder(const thread_holder &) = delete;
+        thread_holder &operator=(const thread_holder &) = delete;
+        ~thread_holder()
+        {
+          frame_cache *c = cache;
+          cache = nullptr;
+          c->_thread_exit();
+        }
+      };
+      static thread_holder &_holder()
+      {
+        static thread_local thread_holder h;
+        return h;
+      }
+
+      static header *&_next(header *h) noexcept { return *reinterpret_cast<header **>(h + 1); }
+      static unsigned _bucket_for(size_t bytes) noexcept
+      {
+        unsigned b = 0;
+        while(b < buckets && (smallest_block << b) < bytes)
+        {
+          ++b;
+        }
+        return b;
+      }
+
+      void _push_local(header *h) noexcept
       {
+        if(_local_count[h->bucket] >= max_cached_per_bucket)
+        {
+          ::operator delete(h);
+          return;
+        }
+        _next(h) = _local[h->bucket];
+        _local[h->bucket] = h;
+        ++_local_count[h->bucket];
+      }
+      void _push_remote(header *h) noexcept
+      {
+        header *head = _remote.load(std::memory_order_relaxed);
+        do
+        {
+          _next(h) = head;
+        } while(!_remote.compare_exchange_weak(head, h, std::memory_order_release, std::memory_order_relaxed));
+        if(_balance.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+          _destroy();
+        }
+      }
+      header *_pop(unsigned bucket) noexcept
+      {
+        if(_local[bucket] == nullptr && _remote.load(std::memory_order_relaxed) != nullptr)
+        {
+          header *h = _remote.exchange(nullptr, std::memory_order_acquire);
+          while(h != nullptr)
+          {
+            header *next = _next(h);
+            _push_local(h);
+            h = next;
+          }
+        }
+        header *h = _local[bucket];
+        if(h != nullptr)
+        {
+          _local[bucket] = _next(h);
+          --_local_count[bucket];
+        }
+        return h;
+      }
+      static void _free_list(header *h) noexcept
+      {
+        while(h != nullptr)
+        {
+          header *next = _next(h);
+          ::operator delete(h);
+          h = next;
+        }
+      }
+      void _destroy() noexcept
+      {
+        _free_list(_remote.exchange(nullptr, std::memory_order_acquire));
+        delete this;
+      }
+      void _thread_exit() noexcept
+      {
+        for(auto &i : _local)
+        {
+          _free_list(i);
+          i = nullptr;
+        }
+        _free_list(_remote.exchange(nullptr, std::memory_order_acquire));
+        if(_balance.fetch_add(_outstanding, std::memory_order_acq_rel) + _outstanding == 0)
+        {
+          _destroy();
+        }
+      }
+
+      template <class A> static constexpr size_t _allocator_offset(size_t n) noexcept { return (sizeof(header) + n + alignof(A) - 1) & ~(alignof(A) - 1); }
+      template <class A> static constexpr size_t _allocator_headers(size_t n) noexcept
+      {
+        return (_allocator_offset<A>(n) + sizeof(A) + sizeof(header) - 1) / sizeof(header);
+      }
+      template <class A> static void _release_with(header *h, size_t n) noexcept
+      {
+        A *stored = reinterpret_cast<A *>(reinterpret_cast<char *>(h) + _allocator_offset<A>(n));
+        A a(static_cast<A &&>(*stored));
+        stored->~A();
+        std::allocator_traits<A>::deallocate(a, h, _allocator_headers<A>(n));
+      }
+
+    public:
+      //! Allocates a coroutine frame of `n` bytes, from this thread's cache if possible.
+      static void *allocate(size_t n)
+      {
+#if OUTCOME_COROUTINE_RECYCLE_FRAMES
+        const unsigned bucket = _bucket_for(sizeof(header) + n);
+        frame_cache *c = (bucket < buckets) ? _holder().cache : nullptr;
+        if(c != nullptr)
+        {
+          header *h = c->_pop(bucket);
+          if(h == nullptr)
+          {
+            h = static_cast<header *>(::operator new(smallest_block << bucket));
+          }
+          h->owner = c;
+          h->bucket = bucket;
+          ++c->_outstanding;
+          return h + 1;
+        }
+#endif
+        auto *h = static_cast<header *>(::operator new(sizeof(header) + n));
+        h->owner = nullptr;
+        h->bucket = uncached_bucket;
+        return h + 1;
+      }
+      //! Allocates a coroutine frame of `n` bytes using a copy of `alloc`, which is kept in the allocation.
+      template <class Alloc> static void *allocate(size_t n, const Alloc &alloc)
+      {
+        using header_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<header>;
+        header_allocator a(alloc);
+        header *h = std::allocator_traits<header_allocator>::allocate(a, _allocator_headers<header_allocator>(n));
+        new(reinterpret_cast<char *>(h) + _allocator_offset<header_allocator>(n)) header_allocator(static_cast<header_allocator &&>(a));
+        h->release = &_release_with<header_allocator>;
+        h->bucket = allocator_bucket;
+        return h + 1;
+      }
+      //! Frees a coroutine frame of `n` bytes, which may have been allocated by any thread.
+      static void deallocate(void *p, size_t n) noexcept
+      {
+        header *h = static_cast<header *>(p) - 1;
+        if(h->bucket == uncached_bucket)
+        {
+          ::operator delete(h);
+          return;
+        }
+        if(h->bucket == allocator_bucket)
+        {
+          h->release(h, n);
+          return;
+        }
+        frame_cache *c = h->owner;
+        if(c == _holder().cache)
+        {
+          --c->_outstanding;
+          c->_push_local(h);
+          return;
+        }
+        c->_push_remote(h);
       }
-      T load(std::memory_order /*unused*/) { return _v; }
-      void store(T v, std::memory_order /*unused*/) { _v = v; }
     };
 
-#ifdef OUTCOME_FOUND_COROUTINE_HEADER
-    template <class Awaitable, bool suspend_initial, bool use_atomic, bool is_void> struct outcome_promise_type
+    // Gives a promise type frame allocation from frame_cache, and allocator awareness when the
+    // coroutine's parameters begin with (std::allocator_arg_t, Alloc), after any implicit object parameter.
+    struct promise_frame_allocation
+    {
+      static void *operator new(size_t n) { return frame_cache::allocate(n); }
+      template <class Alloc, class... Args> static void *operator new(size_t n, std::allocator_arg_t /*unused*/, const Alloc &alloc, const Args &... /*unused*/)
+      {
+        return frame_cache::allocate(n, alloc);
+      }
+      template <class This, class Alloc, class... Args>
+      static void *operator new(size_t n, const This & /*unused*/, std::allocator_arg_t /*unused*/, const Alloc &alloc, const Args &... /*unused*/)
+      {
+        return frame_cache::allocate(n, alloc);
+      }
+      static void operator delete(void *p, size_t n) noexcept { frame_cache::deallocate(p, n); }
+    };
+
+    template <class Awaitable, bool suspend_initial, bool use_atomic, bool is_void> struct outcome_promise_type : promise_frame_allocation
     {
       using container_type = typename Awaitable::container_type;
-      using result_set_type = std::conditional_t<use_atomic, std::atomic<bool>, fake_atomic<bool>>;
+      using result_set_type = std::conditional_t<use_atomic, std::atomic<bool>, bool>;
       union
       {
         OUTCOME_V2_NAMESPACE::detail::empty_type _default{};
@@ -137,6 +387,11 @@ namespace awaitables
       };
       result_set_type result_set{false};
       coroutine_handle<> continuation;
+#if OUTCOME_HAVE_STOP_TOKEN
+      std::stop_token own_stop_token;
+      // The token observed, which is own_stop_token unless inherited from the awaiting coroutine
+      const std::stop_token *stop_token{&own_stop_token};
+#endif
 
       outcome_promise_type() noexcept {}
       outcome_promise_type(const outcome_promise_type &) = delete;
@@ -145,7 +400,7 @@ namespace awaitables
       outcome_promise_type &operator=(outcome_promise_type &&) = delete;
       ~outcome_promise_type()
       {
-        if(result_set.load(std::memory_order_acquire))
+        if(detail::result_is_set(result_set))
         {
           result.~container_type();  // could throw
         }
@@ -156,28 +411,28 @@ namespace awaitables
       }
       void return_value(container_type &&value)
       {
-        assert(!result_set.load(std::memory_order_acquire));
-        if(result_set.load(std::memory_order_acquire))
+        assert(!detail::result_is_set(result_set));
+        if(detail::result_is_set(result_set))
         {
           result.~container_type();  // could throw
         }
         new(&result) container_type(static_cast<container_type &&>(value));  // could throw
-        result_set.store(true, std::memory_order_release);
+        detail::mark_result_set(result_set);
       }
       void return_value(const container_type &value)
       {
-        assert(!result_set.load(std::memory_order_acquire));
-        if(result_set.load(std::memory_order_acquire))
+        assert(!detail::result_is_set(result_set));
+        if(detail::result_is_set(result_set))
         {
           result.~container_type();  // could throw
         }
         new(&result) container_type(value);  // could throw
-        result_set.store(true, std::memory_order_release);
+        detail::mark_result_set(result_set);
       }
       void unhandled_exception()
       {
-        assert(!result_set.load(std::memory_order_acquire));
-        if(result_set.load(std::memory_order_acquire))
+        assert(!detail::result_is_set(result_set));
+        if(detail::result_is_set(result_set))
         {
           result.~container_type();
         }
@@ -192,7 +447,18 @@ namespace awaitables
 #else
         std::terminate();
 #endif
-        result_set.store(true, std::memory_order_release);
+        detail::mark_result_set(result_set);
+      }
+      // Completes with errc::operation_canceled, if the container can represent it
+      bool set_cancelled()
+      {
+        assert(!detail::result_is_set(result_set));
+        if(!detail::try_set_cancelled(&result))
+        {
+          return false;
+        }
+        detail::mark_result_set(result_set);
+        return true;
       }
       auto initial_suspend() noexcept
       {
@@ -228,12 +494,17 @@ namespace awaitables
         return awaiter{};
       }
     };
-    template <class Awaitable, bool suspend_initial, bool use_atomic> struct outcome_promise_type<Awaitable, suspend_initial, use_atomic, true>
+    template <class Awaitable, bool suspend_initial, bool use_atomic> struct outcome_promise_type<Awaitable, suspend_initial, use_atomic, true> : promise_frame_allocation
     {
       using container_type = void;
-      using result_set_type = std::conditional_t<use_atomic, std::atomic<bool>, fake_atomic<bool>>;
+      using result_set_type = std::conditional_t<use_atomic, std::atomic<bool>, bool>;
       result_set_type result_set{false};
       coroutine_handle<> continuation;
+#if OUTCOME_HAVE_STOP_TOKEN
+      std::stop_token own_stop_token;
+      // The token observed, which is own_stop_token unless inherited from the awaiting coroutine
+      const std::stop_token *stop_token{&own_stop_token};
+#endif
 
       outcome_promise_type() {}
       outcome_promise_type(const outcome_promise_type &) = delete;
@@ -247,14 +518,15 @@ namespace awaitables
       }
       void return_void() noexcept
       {
-        assert(!result_set.load(std::memory_order_acquire));
-        result_set.store(true, std::memory_order_release);
+        assert(!detail::result_is_set(result_set));
+        detail::mark_result_set(result_set);
       }
       void unhandled_exception()
       {
-        assert(!result_set.load(std::memory_order_acquire));
+        assert(!detail::result_is_set(result_set));
         std::rethrow_exception(std::current_exception());  // throws
       }
+      bool set_cancelled() noexcept { return false; }
       auto initial_suspend() noexcept
       {
         struct awaiter
@@ -299,6 +571,86 @@ namespace awaitables
     {
     }
 
+    /* Cancellation is cooperative. A lazy awaitable inherits the stop token of the coroutine
+    awaiting it unless given one of its own, and if stop has already been requested it completes
+    with errc::operation_canceled without ever being started. Inheriting points at the token of
+    the awaiting coroutine, which outlives the awaited one, so no token is copied. A running coroutine observes its
+    token at a cancellation_point(), where it completes cancelled by transferring straight to
+    its continuation. It is left suspended there and its locals are destroyed with the frame.
+    */
+#if OUTCOME_HAVE_STOP_TOKEN
+    template <class Promise, class = decltype(std::declval<Promise &>().stop_token)>
+    inline void inherit_stop_token(const std::stop_token *&token, coroutine_handle<Promise> parent, int /*unused*/) noexcept
+    {
+      if(!token->stop_possible())
+      {
+        token = parent.promise().stop_token;
+      }
+    }
+    template <class Promise> inline void inherit_stop_token(const std::stop_token *& /*unused*/, coroutine_handle<Promise> /*unused*/, ...) noexcept {}
+    template <class Promise, class Parent> inline bool cancel_before_start(Promise &p, coroutine_handle<Parent> parent) noexcept
+    {
+      inherit_stop_token(p.stop_token, parent, 0);
+      return p.stop_token->stop_requested() && p.set_cancelled();
+    }
+
+    struct get_stop_token_awaiter
+    {
+      std::stop_token _token;
+
+      bool await_ready() noexcept { return false; }
+      template <class Promise> bool await_suspend(coroutine_handle<Promise> self) noexcept
+      {
+        _token = *self.promise().stop_token;
+        return false;
+      }
+      std::stop_token await_resume() noexcept { return static_cast<std::stop_token &&>(_token); }
+    };
+    // Passes stop requested of an awaiting coroutine on to a stop_source of its own children
+    struct forward_stop
+    {
+      std::stop_source *source;
+      void operator()() const noexcept { source->request_stop(); }
+    };
+
+    struct cancellation_point_awaiter
+    {
+      bool await_ready() noexcept { return false; }
+      void await_resume() noexcept {}
+#if OUTCOME_HAVE_NOOP_COROUTINE
+      template <class Promise> coroutine_handle<> await_suspend(coroutine_handle<Promise> self) noexcept
+      {
+        static_assert(std::is_constructible<typename Promise::container_type, std::errc>::value,
+                      "cancellation_point() requires a coroutine returning a type constructible from errc::operation_canceled");
+        Promise &p = self.promise();
+        if(!p.stop_token->stop_requested() || !p.set_cancelled())
+        {
+          return self;
+        }
+        return p.continuation ? p.continuation : noop_coroutine();
+      }
+#else
+      template <class Promise> bool await_suspend(coroutine_handle<Promise> self)
+      {
+        static_assert(std::is_constructible<typename Promise::container_type, std::errc>::value,
+                      "cancellation_point() requires a coroutine returning a type constructible from errc::operation_canceled");
+        Promise &p = self.promise();
+        if(!p.stop_token->stop_requested() || !p.set_cancelled())
+        {
+          return false;
+        }
+        if(p.continuation)
+        {
+          p.continuation.resume();
+        }
+        return true;
+      }
+#endif
+    };
+#else
+    template <class Promise, class Parent> constexpr inline bool cancel_before_start(Promise & /*unused*/, coroutine_handle<Parent> /*unused*/) noexcept { return false; }
+#endif
+
     template <class Cont, bool suspend_initial, bool use_atomic> struct OUTCOME_NODISCARD awaitable
     {
       using container_type = Cont;
@@ -324,14 +676,20 @@ namespace awaitables
           : _h(coroutine_handle<promise_type>::from_promise(p))
       {
       }
-      bool await_ready() noexcept { return _h.promise().result_set.load(std::memory_order_acquire); }
-      container_type await_resume()
+      // An atomic awaitable may be resumed by a racing thread, so its result is checked even when
+      // NDEBUG is defined. Otherwise the result was set by this thread before resuming it.
+      void _check_result_set(std::true_type /*unused*/) noexcept
       {
-        assert(_h.promise().result_set.load(std::memory_order_acquire));
-        if(!_h.promise().result_set.load(std::memory_order_acquire))
+        if(!detail::result_is_set(_h.promise().result_set))
         {
           std::terminate();
         }
+      }
+      void _check_result_set(std::false_type /*unused*/) noexcept { assert(detail::result_is_set(_h.promise().result_set)); }
+      bool await_ready() noexcept { return detail::result_is_set(_h.promise().result_set); }
+      container_type await_resume()
+      {
+        _check_result_set(std::integral_constant<bool, use_atomic>());
         return detail::move_result_from_promise_if_not_void(_h.promise());
       }
 #if OUTCOME_HAVE_NOOP_COROUTINE
@@ -340,14 +698,779 @@ namespace awaitables
         _h.promise().continuation = cont;
         return _h;
       }
+      template <class Promise> coroutine_handle<> await_suspend(coroutine_handle<Promise> cont) noexcept
+      {
+        _h.promise().continuation = cont;
+        // Only a lazy awaitable is known not to be running, so only it can inherit
+        if(suspend_initial && detail::cancel_before_start(_h.promise(), cont))
+        {
+          return cont;
+        }
+        return _h;
+      }
 #else
       void await_suspend(coroutine_handle<> cont)
       {
         _h.promise().continuation = cont;
         _h.resume();
       }
+      template <class Promise> bool await_suspend(coroutine_handle<Promise> cont)
+      {
+        _h.promise().continuation = cont;
+        if(suspend_initial && detail::cancel_before_start(_h.promise(), cont))
+        {
+          return false;
+        }
+        _h.resume();
+        return true;
+      }
+#endif
+#if OUTCOME_HAVE_STOP_TOKEN
+      //! Sets the stop token of a lazy awaitable not yet awaited, overriding any it would inherit.
+      void set_stop_token(std::stop_token token) noexcept
+      {
+        static_assert(suspend_initial, "Only a lazy awaitable can be given a stop token, an eager one is already running");
+        _h.promise().own_stop_token = static_cast<std::stop_token &&>(token);
+        _h.promise().stop_token = &_h.promise().own_stop_token;
+      }
 #endif
     };
+
+    /* when_all() and when_any() run each child under a small combinator_task coroutine, whose
+    frame comes from frame_cache like any other. The children share one combinator_state in the
+    frame of the combining coroutine: a countdown of children yet to complete plus one for the
+    starting loop, and the index of the first child whose completion decides the answer. The
+    final suspend of each task, and the starting loop, decrement the countdown, and whoever
+    brings it to zero resumes the combining coroutine.
+
+    Once the answer is decided, lazy children not yet started are never started, and are
+    destroyed unrun. The children are given the stop token of the state's own stop_source, to
+    which stop requested of the combining coroutine is forwarded, and stop is requested of it
+    when the answer is decided. Children already running therefore complete cancelled at their
+    next cancellation_point(), and are awaited until they do. Eager children never inherit a stop
+    token, so those still running are awaited to completion.
+    */
+    struct combinator_state
+    {
+      static constexpr size_t undecided = static_cast<size_t>(-1);
+      std::atomic<size_t> countdown{0};
+      std::atomic<size_t> decided_by{undecided};
+      coroutine_handle<> parent;
+#if OUTCOME_HAVE_STOP_TOKEN
+      std::stop_source _source;
+      std::stop_token _token{_source.get_token()};
+#endif
+
+      bool decided() const noexcept { return decided_by.load(std::memory_order_acquire) != undecided; }
+      // Returns true if idx decided the answer
+      bool decide(size_t idx) noexcept
+      {
+        size_t expected = undecided;
+        if(!decided_by.compare_exchange_strong(expected, idx, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+          return false;
+        }
+#if OUTCOME_HAVE_STOP_TOKEN
+        _source.request_stop();
+#endif
+        return true;
+      }
+      bool done() noexcept { return countdown.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+    };
+
+    struct OUTCOME_NODISCARD combinator_task
+    {
+      struct promise_type : promise_frame_allocation
+      {
+        combinator_state *state{nullptr};
+#if OUTCOME_HAVE_STOP_TOKEN
+        const std::stop_token *stop_token{nullptr};
+#endif
+
+        combinator_task get_return_object() noexcept { return combinator_task{coroutine_handle<promise_type>::from_promise(*this)}; }
+        suspend_always initial_suspend() noexcept { return {}; }
+        auto final_suspend() noexcept
+        {
+          struct awaiter
+          {
+            bool await_ready() noexcept { return false; }
+            void await_resume() noexcept {}
+#if OUTCOME_HAVE_NOOP_COROUTINE
+            coroutine_handle<> await_suspend(coroutine_handle<promise_type> self) noexcept
+            {
+              combinator_state *state = self.promise().state;
+              return state->done() ? state->parent : noop_coroutine();
+            }
+#else
+            void await_suspend(coroutine_handle<promise_type> self)
+            {
+              combinator_state *state = self.promise().state;
+              if(state->done())
+              {
+                return state->parent.resume();
+              }
+            }
+#endif
+          };
+          return awaiter{};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+      };
+      coroutine_handle<promise_type> _h;
+
+      combinator_task() = default;
+      explicit combinator_task(coroutine_handle<promise_type> h) noexcept
+          : _h(h)
+      {
+      }
+      combinator_task(combinator_task &&o) noexcept
+          : _h(o._h)
+      {
+        o._h = nullptr;
+      }
+      combinator_task(const combinator_task &) = delete;
+      combinator_task &operator=(combinator_task &&) = delete;
+      combinator_task &operator=(const combinator_task &) = delete;
+      ~combinator_task()
+      {
+        if(_h)
+        {
+          _h.destroy();
+        }
+      }
+    };
+
+    // Storage for the result of a child, constructed only if the child was started
+    template <class Cont> struct combinator_slot
+    {
+      union
+      {
+        OUTCOME_V2_NAMESPACE::detail::empty_type _default{};
+        Cont result;
+      };
+      bool set{false};
+
+      combinator_slot() noexcept {}
+      combinator_slot(const combinator_slot &) = delete;
+      combinator_slot(combinator_slot &&) = delete;
+      combinator_slot &operator=(const combinator_slot &) = delete;
+      combinator_slot &operator=(combinator_slot &&) = delete;
+      ~combinator_slot()
+      {
+        if(set)
+        {
+          result.~Cont();
+        }
+      }
+      void emplace(Cont &&v)
+      {
+        new(&result) Cont(static_cast<Cont &&>(v));
+        set = true;
+      }
+    };
+
+    // when_all() is decided by the first failure, when_any() by the first success
+    template <bool decide_on_value, class Child, class Cont>
+    inline combinator_task combinator_run(Child &child, combinator_slot<Cont> &slot, combinator_state &state, size_t idx)
+    {
+      slot.emplace(co_await child);
+      if(slot.result.has_value() == decide_on_value)
+      {
+        state.decide(idx);
+      }
+    }
+
+    template <class T> struct combinator_child
+    {
+      static constexpr bool is_awaitable = false;
+    };
+    template <class Cont, bool suspend_initial, bool use_atomic> struct combinator_child<awaitable<Cont, suspend_initial, use_atomic>>
+    {
+      static constexpr bool is_awaitable = OUTCOME_V2_NAMESPACE::is_basic_result<Cont>::value;
+      static constexpr bool is_lazy = suspend_initial;
+      static constexpr bool is_atomic = use_atomic;
+      using container_type = Cont;
+    };
+    template <class... Children> struct combinator_children;
+    template <> struct combinator_children<>
+    {
+      static constexpr bool are_awaitables = true;
+      static constexpr bool any_atomic = false;
+    };
+    template <class Child, class... Children> struct combinator_children<Child, Children...>
+    {
+      static constexpr bool are_awaitables = combinator_child<Child>::is_awaitable && combinator_children<Children...>::are_awaitables;
+      static constexpr bool any_atomic = combinator_child<Child>::is_atomic || combinator_children<Children...>::any_atomic;
+    };
+
+    /* Awaiting this starts each child in turn, skipping lazy children once the answer is decided.
+    A child's task is only created when it is started, so a skipped child costs no frame.
+    */
+    template <bool decide_on_value, class Children, class Slots, class Indices> struct combinator_start;
+    template <bool decide_on_value, class Children, class Slots, size_t... Is>
+    struct combinator_start<decide_on_value, Children, Slots, std::index_sequence<Is...>>
+    {
+      Children &children;
+      Slots &slots;
+      combinator_state &state;
+      combinator_task tasks[sizeof...(Is)];
+
+      combinator_start(Children &c, Slots &s, combinator_state &st) noexcept
+          : children(c)
+          , slots(s)
+          , state(st)
+      {
+      }
+
+      template <size_t I> void _start()
+      {
+        if(combinator_child<std::tuple_element_t<I, Children>>::is_lazy && state.decided())
+        {
+          state.countdown.fetch_sub(1, std::memory_order_relaxed);
+          return;
+        }
+        combinator_task t = combinator_run<decide_on_value>(std::get<I>(children), std::get<I>(slots), state, I);
+        tasks[I]._h = t._h;
+        t._h = nullptr;
+        tasks[I]._h.promise().state = &state;
+#if OUTCOME_HAVE_STOP_TOKEN
+        tasks[I]._h.promise().stop_token = &state._token;
+#endif
+        tasks[I]._h.resume();
+      }
+
+      bool await_ready() noexcept { return false; }
+      void await_resume() noexcept {}
+      template <class Promise> bool await_suspend(coroutine_handle<Promise> parent)
+      {
+        state.parent = parent;
+        state.countdown.store(sizeof...(Is) + 1, std::memory_order_relaxed);
+        int unused[] = {(_start<Is>(), 0)...};
+        (void) unused;
+        // Stay suspended unless every child completed during the loop
+        return !state.done();
+      }
+    };
+
+    // Policies parameterised by the value type are rebound to the combined value type
+    template <class Policy, class T> struct rebind_no_value_policy
+    {
+      using type = Policy;
+    };
+    template <template <class, class, class> class Policy, class U, class EC, class EP, class T> struct rebind_no_value_policy<Policy<U, EC, EP>, T>
+    {
+      using type = Policy<T, EC, EP>;
+    };
+
+    template <class First, class... Conts> struct when_all_result
+    {
+      using value_type = std::tuple<typename First::value_type, typename Conts::value_type...>;
+      using error_type = typename First::error_type;
+      static_assert(std::is_same<std::tuple<typename Conts::error_type...>, std::tuple<std::conditional_t<true, error_type, Conts>...>>::value, "when_all() requires all children to have the same error type");
+      using type = basic_result<value_type, error_type, typename rebind_no_value_policy<typename First::no_value_policy_type, value_type>::type>;
+    };
+
+    template <class R, size_t I, class Slots> inline R combinator_failure_at(Slots &slots, size_t /*unused*/, std::false_type /*more*/)
+    {
+      return R(static_cast<decltype(std::get<I>(slots).result) &&>(std::get<I>(slots).result).as_failure());
+    }
+    template <class R, size_t I, class Slots> inline R combinator_failure_at(Slots &slots, size_t which, std::true_type /*more*/)
+    {
+      if(which == I)
+      {
+        return R(static_cast<decltype(std::get<I>(slots).result) &&>(std::get<I>(slots).result).as_failure());
+      }
+      return combinator_failure_at<R, I + 1>(slots, which, std::integral_constant<bool, (I + 2 < std::tuple_size<Slots>::value)>());
+    }
+    template <class R, size_t I, class Slots> inline R combinator_take(Slots &slots, size_t /*unused*/, std::false_type /*more*/)
+    {
+      return static_cast<R &&>(std::get<I>(slots).result);
+    }
+    template <class R, size_t I, class Slots> inline R combinator_take(Slots &slots, size_t which, std::true_type /*more*/)
+    {
+      if(which == I)
+      {
+        return static_cast<R &&>(std::get<I>(slots).result);
+      }
+      return combinator_take<R, I + 1>(slots, which, std::integral_constant<bool, (I + 2 < std::tuple_size<Slots>::value)>());
+    }
+    template <class R, class Slots, size_t... Is> inline R combinator_values(Slots &slots, std::index_sequence<Is...> /*unused*/)
+    {
+      return R{in_place_type<typename R::value_type>, static_cast<decltype(std::get<Is>(slots).result) &&>(std::get<Is>(slots).result).assume_value()...};
+    }
+
+    template <class Ret, class... Children> inline Ret when_all_impl(std::tuple<Children...> children)
+    {
+      using result_type = typename Ret::container_type;
+      using indices = std::index_sequence_for<Children...>;
+      std::tuple<combinator_slot<typename Children::container_type>...> slots;
+      combinator_state state;
+#if OUTCOME_HAVE_STOP_TOKEN
+      // Stop requested of the combining coroutine is passed on to the children
+      std::stop_callback<forward_stop> forward(co_await get_stop_token_awaiter{}, forward_stop{&state._source});
+#endif
+      co_await combinator_start<false, std::tuple<Children...>, decltype(slots), indices>(children, slots, state);
+      if(state.decided())
+      {
+        co_return combinator_failure_at<result_type, 0>(slots, state.decided_by.load(std::memory_order_acquire), std::integral_constant<bool, (1 < sizeof...(Children))>());
+      }
+      co_return combinator_values<result_type>(slots, indices());
+    }
+
+    template <class Ret, class... Children> inline Ret when_any_impl(std::tuple<Children...> children)
+    {
+      using result_type = typename Ret::container_type;
+      static_assert(std::is_same<std::tuple<typename Children::container_type...>, std::tuple<std::conditional_t<true, result_type, Children>...>>::value,
+                    "when_any() requires all children to return the same type");
+      std::tuple<combinator_slot<std::conditional_t<true, result_type, Children>>...> slots;
+      combinator_state state;
+#if OUTCOME_HAVE_STOP_TOKEN
+      // Stop requested of the combining coroutine is passed on to the children
+      std::stop_callback<forward_stop> forward(co_await get_stop_token_awaiter{}, forward_stop{&state._source});
+#endif
+      co_await combinator_start<true, std::tuple<Children...>, decltype(slots), std::index_sequence_for<Children...>>(children, slots, state);
+      // If everything failed then every child was started, so report the first failure by position
+      const size_t idx = state.decided() ? state.decided_by.load(std::memory_order_acquire) : 0;
+      co_return combinator_take<result_type, 0>(slots, idx, std::integral_constant<bool, (1 < sizeof...(Children))>());
+    }
+
+    /* A generator's frame suspends before running, at each co_yield, and at the end. Each
+    yielded result is kept in the promise until the next resumption, so nothing but the frame
+    is allocated. A co_return of anything but success() is delivered as a final element, which
+    is how OUTCOME_CO_TRY ends the stream with its failure. As the promise needs return_value()
+    for that, it cannot also have return_void(), so every generator must end with
+    `co_return success();`. Flowing off the end of a generator is undefined behaviour.
+    */
+    template <class Cont> class OUTCOME_NODISCARD generator
+    {
+      static_assert(OUTCOME_V2_NAMESPACE::is_basic_result<Cont>::value, "generator<T> requires T to be a basic_result");
+
+    public:
+      using container_type = Cont;
+      using value_type = typename container_type::value_type;
+      using error_type = typename container_type::error_type;
+      using status_type = basic_result<void, error_type, typename rebind_no_value_policy<typename container_type::no_value_policy_type, void>::type>;
+
+      struct promise_type : promise_frame_allocation
+      {
+        union
+        {
+          OUTCOME_V2_NAMESPACE::detail::empty_type _default{};
+          container_type result;
+        };
+        bool result_set{false};
+
+        promise_type() noexcept {}
+        promise_type(const promise_type &) = delete;
+        promise_type(promise_type &&) = delete;
+        promise_type &operator=(const promise_type &) = delete;
+        promise_type &operator=(promise_type &&) = delete;
+        ~promise_type() { reset(); }
+
+        void reset() noexcept
+        {
+          if(result_set)
+          {
+            result.~container_type();
+            result_set = false;
+          }
+        }
+        template <class U> void set(U &&v)
+        {
+          reset();
+          new(&result) container_type(static_cast<U &&>(v));  // could throw
+          result_set = true;
+        }
+
+        generator get_return_object() noexcept { return generator(coroutine_handle<promise_type>::from_promise(*this)); }
+        suspend_always initial_suspend() noexcept { return {}; }
+        suspend_always final_suspend() noexcept { return {}; }
+        OUTCOME_TEMPLATE(class U)
+        OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_constructible<container_type, U>::value))
+        suspend_always yield_value(U &&v)
+        {
+          set(static_cast<U &&>(v));
+          return {};
+        }
+        void return_value(success_type<void> /*unused*/) noexcept { reset(); }
+        OUTCOME_TEMPLATE(class U)
+        OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_constructible<container_type, U>::value))
+        void return_value(U &&v) { set(static_cast<U &&>(v)); }
+        void unhandled_exception()
+        {
+          reset();
+#ifdef __cpp_exceptions
+          auto e = std::current_exception();
+          auto ec = detail::error_from_exception(static_cast<decltype(e) &&>(e), {});
+          // Try to set error code first
+          if(!detail::error_is_set(ec) || !detail::try_set_error(static_cast<decltype(ec) &&>(ec), &result))
+          {
+            detail::set_or_rethrow(e, &result);  // could throw
+          }
+          result_set = true;
+#else
+          std::terminate();
+#endif
+        }
+      };
+
+    private:
+      coroutine_handle<promise_type> _h;
+      bool _finished{false};
+
+      // Resumes the generator for its next result, returning false if there is none
+      bool _advance()
+      {
+        if(_finished)
+        {
+          _h.promise().reset();
+          return false;
+        }
+        _h.resume();
+        if(_h.done())
+        {
+          _finished = true;
+        }
+        return _h.promise().result_set;
+      }
+      bool _has_result() const noexcept { return _h.promise().result_set; }
+
+    public:
+      class iterator
+      {
+        generator *_g{nullptr};
+
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = container_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = container_type *;
+        using reference = container_type &;
+
+        constexpr iterator() noexcept = default;
+        constexpr explicit iterator(generator *g) noexcept
+            : _g(g)
+        {
+        }
+        reference operator*() const noexcept { return _g->_h.promise().result; }
+        pointer operator->() const noexcept { return &_g->_h.promise().result; }
+        iterator &operator++()
+        {
+          if(!_g->_advance())
+          {
+            _g = nullptr;
+          }
+          return *this;
+        }
+        void operator++(int) { ++*this; }
+        bool operator==(const iterator &o) const noexcept { return _g == o._g; }
+        bool operator!=(const iterator &o) const noexcept { return _g != o._g; }
+      };
+
+      //! A range over the values yielded, which ends before the first failure.
+      class values_range
+      {
+        generator *_g;
+
+      public:
+        class iterator
+        {
+          generator *_g{nullptr};
+
+        public:
+          using iterator_category = std::input_iterator_tag;
+          using value_type = typename generator::value_type;
+          using difference_type = std::ptrdiff_t;
+          using pointer = value_type *;
+          using reference = value_type &;
+
+          constexpr iterator() noexcept = default;
+          explicit iterator(generator *g) noexcept
+              : _g((g != nullptr && g->_has_result() && g->_h.promise().result.has_value()) ? g : nullptr)
+          {
+          }
+          reference operator*() const noexcept { return _g->_h.promise().result.assume_value(); }
+          pointer operator->() const noexcept { return &_g->_h.promise().result.assume_value(); }
+          iterator &operator++()
+          {
+            if(!_g->_advance() || !_g->_h.promise().result.has_value())
+            {
+              _g = nullptr;
+            }
+            return *this;
+          }
+          void operator++(int) { ++*this; }
+          bool operator==(const iterator &o) const noexcept { return _g == o._g; }
+          bool operator!=(const iterator &o) const noexcept { return _g != o._g; }
+        };
+
+        explicit values_range(generator *g) noexcept
+            : _g(g)
+        {
+        }
+        iterator begin() { return _g->_advance() ? iterator(_g) : iterator(); }
+        iterator end() noexcept { return iterator(); }
+      };
+
+      explicit generator(coroutine_handle<promise_type> h) noexcept
+          : _h(h)
+      {
+      }
+      generator(generator &&o) noexcept
+          : _h(o._h)
+          , _finished(o._finished)
+      {
+        o._h = nullptr;
+      }
+      generator(const generator &) = delete;
+      generator &operator=(generator &&) = delete;
+      generator &operator=(const generator &) = delete;
+      ~generator()
+      {
+        if(_h)
+        {
+          _h.destroy();
+        }
+      }
+
+      //! Iterates every result yielded, including failures. Iteration begins the generator.
+      iterator begin() { return _advance() ? iterator(this) : iterator(); }
+      iterator end() noexcept { return iterator(); }
+      //! Iterates the values yielded, stopping at the first failure, which `status()` then reports.
+      values_range values() noexcept { return values_range(this); }
+      //! The failure `values()` stopped at, if any, else success.
+      status_type status() const
+      {
+        if(_h && _h.promise().result_set && !_h.promise().result.has_value())
+        {
+          return status_type(_h.promise().result.as_failure());
+        }
+        return status_type(in_place_type<void>);
+      }
+    };
+
+    /* A shared awaitable's frame is reference counted by the copies of the awaitable. Its state
+    word is null before the first co_await, the address of itself once the result is ready, else
+    the head of an intrusive stack of waiters, which is never empty while the coroutine runs. Each waiter node lives in the awaiter, so in the awaiting coroutine's frame.
+    The first awaiter pushes itself and starts the coroutine, and at its final suspend point the
+    coroutine swaps the state to ready and resumes every waiter it swapped out.
+    */
+    struct shared_waiter
+    {
+      coroutine_handle<> awaiting;
+      shared_waiter *next{nullptr};
+    };
+
+    template <class Cont, bool is_void> struct shared_promise_result : promise_frame_allocation
+    {
+      union
+      {
+        OUTCOME_V2_NAMESPACE::detail::empty_type _default{};
+        Cont result;
+      };
+      bool result_set{false};
+
+      shared_promise_result() noexcept {}
+      shared_promise_result(const shared_promise_result &) = delete;
+      shared_promise_result(shared_promise_result &&) = delete;
+      shared_promise_result &operator=(const shared_promise_result &) = delete;
+      shared_promise_result &operator=(shared_promise_result &&) = delete;
+      ~shared_promise_result()
+      {
+        if(result_set)
+        {
+          result.~Cont();
+        }
+      }
+      void return_value(Cont &&value)
+      {
+        new(&result) Cont(static_cast<Cont &&>(value));  // could throw
+        result_set = true;
+      }
+      void return_value(const Cont &value)
+      {
+        new(&result) Cont(value);  // could throw
+        result_set = true;
+      }
+      void unhandled_exception()
+      {
+#ifdef __cpp_exceptions
+        auto e = std::current_exception();
+        auto ec = detail::error_from_exception(static_cast<decltype(e) &&>(e), {});
+        // Try to set error code first
+        if(!detail::error_is_set(ec) || !detail::try_set_error(static_cast<decltype(ec) &&>(ec), &result))
+        {
+          detail::set_or_rethrow(e, &result);  // could throw
+        }
+        result_set = true;
+#else
+        std::terminate();
+#endif
+      }
+      const Cont &get() const noexcept { return result; }
+    };
+    template <class Cont> struct shared_promise_result<Cont, true> : promise_frame_allocation
+    {
+      void return_void() noexcept {}
+      void unhandled_exception()
+      {
+        std::rethrow_exception(std::current_exception());  // throws
+      }
+      void get() const noexcept {}
+    };
+
+    template <class Cont> class shared_awaitable;
+    template <class Cont> struct shared_promise_type : shared_promise_result<Cont, std::is_void<Cont>::value>
+    {
+      std::atomic<void *> state{nullptr};
+      std::atomic<size_t> refs{1};
+
+      void *ready_marker() noexcept { return &state; }
+      void release(coroutine_handle<shared_promise_type> self) noexcept
+      {
+        if(refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+          self.destroy();
+        }
+      }
+
+      shared_awaitable<Cont> get_return_object() noexcept { return shared_awaitable<Cont>(*this); }
+      suspend_always initial_suspend() noexcept { return {}; }
+      auto final_suspend() noexcept
+      {
+        struct awaiter
+        {
+          bool await_ready() noexcept { return false; }
+          void await_resume() noexcept {}
+          void await_suspend(coroutine_handle<shared_promise_type> self) noexcept
+          {
+            shared_promise_type &p = self.promise();
+            // A waiter may drop the last reference when resumed, so hold one until all are resumed
+            p.refs.fetch_add(1, std::memory_order_relaxed);
+            void *old = p.state.exchange(p.ready_marker(), std::memory_order_acq_rel);
+            auto *w = static_cast<shared_waiter *>(old);
+            while(w != nullptr)
+            {
+              shared_waiter *next = w->next;  // w is gone once its coroutine resumes
+              w->awaiting.resume();
+              w = next;
+            }
+            p.release(self);
+          }
+        };
+        return awaiter{};
+      }
+    };
+
+    template <class Cont> class OUTCOME_NODISCARD shared_awaitable
+    {
+    public:
+      using container_type = Cont;
+      using promise_type = shared_promise_type<Cont>;
+
+    private:
+      coroutine_handle<promise_type> _h;
+
+    public:
+      class awaiter
+      {
+        promise_type *_p;
+        shared_waiter _waiter;
+
+      public:
+        explicit awaiter(promise_type *p) noexcept
+            : _p(p)
+        {
+        }
+        bool await_ready() noexcept { return _p->state.load(std::memory_order_acquire) == _p->ready_marker(); }
+#if OUTCOME_HAVE_NOOP_COROUTINE
+        coroutine_handle<> await_suspend(coroutine_handle<> awaiting) noexcept
+#else
+        bool await_suspend(coroutine_handle<> awaiting)
+#endif
+        {
+          _waiter.awaiting = awaiting;
+          void *old = _p->state.load(std::memory_order_acquire);
+          for(;;)
+          {
+            if(old == _p->ready_marker())
+            {
+#if OUTCOME_HAVE_NOOP_COROUTINE
+              return awaiting;
+#else
+              return false;
+#endif
+            }
+            _waiter.next = static_cast<shared_waiter *>(old);
+            if(_p->state.compare_exchange_weak(old, &_waiter, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+              break;
+            }
+          }
+          if(old == nullptr)
+          {
+            // The first awaiter starts the coroutine
+#if OUTCOME_HAVE_NOOP_COROUTINE
+            return coroutine_handle<promise_type>::from_promise(*_p);
+#else
+            coroutine_handle<promise_type>::from_promise(*_p).resume();
+#endif
+          }
+#if OUTCOME_HAVE_NOOP_COROUTINE
+          return noop_coroutine();
+#else
+          return true;
+#endif
+        }
+        //! A reference to the result, valid for as long as a copy of the shared awaitable exists.
+        decltype(auto) await_resume() const noexcept { return _p->get(); }
+      };
+
+      explicit shared_awaitable(promise_type &p) noexcept
+          : _h(coroutine_handle<promise_type>::from_promise(p))
+      {
+      }
+      shared_awaitable(const shared_awaitable &o) noexcept
+          : _h(o._h)
+      {
+        if(_h)
+        {
+          _h.promise().refs.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+      shared_awaitable(shared_awaitable &&o) noexcept
+          : _h(o._h)
+      {
+        o._h = nullptr;
+      }
+      shared_awaitable &operator=(const shared_awaitable &o) noexcept
+      {
+        shared_awaitable temp(o);
+        coroutine_handle<promise_type> h = _h;
+        _h = temp._h;
+        temp._h = h;
+        return *this;
+      }
+      shared_awaitable &operator=(shared_awaitable &&o) noexcept
+      {
+        coroutine_handle<promise_type> h = _h;
+        _h = o._h;
+        o._h = h;
+        return *this;
+      }
+      ~shared_awaitable()
+      {
+        if(_h)
+        {
+          _h.promise().release(_h);
+        }
+      }
+
+      //! True if the result is ready.
+      bool is_ready() const noexcept { return _h && _h.promise().state.load(std::memory_order_acquire) == _h.promise().ready_marker(); }
+      awaiter operator co_await() const noexcept { return awaiter(&_h.promise()); }
+    };
 #endif
   }  // namespace detail
 
@@ -379,5 +1502,61 @@ SIGNATURE NOT RECOGNISED
 */
 template <class T> using atomic_lazy = OUTCOME_V2_NAMESPACE::awaitables::detail::awaitable<T, true, true>;
 
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class T> using generator = OUTCOME_V2_NAMESPACE::awaitables::detail::generator<T>;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class T> using shared_lazy = OUTCOME_V2_NAMESPACE::awaitables::detail::shared_awaitable<T>;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+OUTCOME_TEMPLATE(class... Children)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(sizeof...(Children) > 0 && OUTCOME_V2_NAMESPACE::awaitables::detail::combinator_children<Children...>::are_awaitables))
+inline auto when_all(Children... children) -> OUTCOME_V2_NAMESPACE::awaitables::detail::awaitable<
+typename OUTCOME_V2_NAMESPACE::awaitables::detail::when_all_result<typename Children::container_type...>::type, true,
+OUTCOME_V2_NAMESPACE::awaitables::detail::combinator_children<Children...>::any_atomic>
+{
+  using ret_type = OUTCOME_V2_NAMESPACE::awaitables::detail::awaitable<
+  typename OUTCOME_V2_NAMESPACE::awaitables::detail::when_all_result<typename Children::container_type...>::type, true,
+  OUTCOME_V2_NAMESPACE::awaitables::detail::combinator_children<Children...>::any_atomic>;
+  return OUTCOME_V2_NAMESPACE::awaitables::detail::when_all_impl<ret_type>(std::tuple<Children...>(static_cast<Children &&>(children)...));
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+OUTCOME_TEMPLATE(class First, class... Children)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(OUTCOME_V2_NAMESPACE::awaitables::detail::combinator_children<First, Children...>::are_awaitables))
+inline auto when_any(First first, Children... children) -> OUTCOME_V2_NAMESPACE::awaitables::detail::awaitable<
+typename First::container_type, true, OUTCOME_V2_NAMESPACE::awaitables::detail::combinator_children<First, Children...>::any_atomic>
+{
+  using ret_type = OUTCOME_V2_NAMESPACE::awaitables::detail::awaitable<typename First::container_type, true,
+                                                                        OUTCOME_V2_NAMESPACE::awaitables::detail::combinator_children<First, Children...>::any_atomic>;
+  return OUTCOME_V2_NAMESPACE::awaitables::detail::when_any_impl<ret_type>(std::tuple<First, Children...>(static_cast<First &&>(first), static_cast<Children &&>(children)...));
+}
+
+#if OUTCOME_HAVE_STOP_TOKEN
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline OUTCOME_V2_NAMESPACE::awaitables::detail::get_stop_token_awaiter get_stop_token() noexcept
+{
+  return {};
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline OUTCOME_V2_NAMESPACE::awaitables::detail::cancellation_point_awaiter cancellation_point() noexcept
+{
+  return {};
+}
+#endif
+
 OUTCOME_COROUTINE_SUPPORT_NAMESPACE_END
 #endif
@@ -0,0 +1,269 @@
+/* Compile time tables for mapping error codes between layers
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_ERROR_MAP_HPP
+#define OUTCOME_ERROR_MAP_HPP
+
+#include "config.hpp"
+
+#include <system_error>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+using error_category_getter = const std::error_category &(*) ();
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <error_category_getter Category, class To> struct error_map_entry
+{
+  int value;
+  To mapped;
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+OUTCOME_TEMPLATE(error_category_getter Category, class From, class To)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_enum<From>::value || std::is_integral<From>::value))
+constexpr inline error_map_entry<Category, To> map_error(From value, To mapped) noexcept
+{
+  return {static_cast<int>(value), mapped};
+}
+
+namespace detail
+{
+  // log2 of the smallest power of two no smaller than twice the entry count, so the table is at most half full
+  constexpr inline size_t error_map_slot_bits(size_t entries) noexcept
+  {
+    size_t bits = 1;
+    while((size_t(1) << bits) < entries * 2)
+    {
+      ++bits;
+    }
+    return bits;
+  }
+  constexpr inline uint64_t error_map_key(size_t category_index, int value) noexcept
+  {
+    return (static_cast<uint64_t>(category_index) << 32U) | static_cast<uint32_t>(value);
+  }
+
+  // Category getters are told apart by type rather than by comparing them, as comparing function
+  // pointers is not reliably a constant expression
+  template <error_category_getter Category> struct error_category_tag
+  {
+  };
+  // The position of Category in Categories, or sizeof...(Categories) if it is not there
+  template <error_category_getter Category, error_category_getter... Categories> struct error_category_position;
+  template <error_category_getter Category> struct error_category_position<Category> : std::integral_constant<size_t, 0>
+  {
+  };
+  template <error_category_getter Category, error_category_getter Head, error_category_getter... Tail>
+  struct error_category_position<Category, Head, Tail...>
+      : std::integral_constant<size_t, std::is_same<error_category_tag<Category>, error_category_tag<Head>>::value ? 0 : 1 + error_category_position<Category, Tail...>::value>
+  {
+  };
+  template <error_category_getter... Categories> struct error_category_list
+  {
+  };
+  // The categories of the entries, each once, in order of first appearance
+  template <class Unique, error_category_getter... Rest> struct error_category_unique;
+  template <error_category_getter... Unique> struct error_category_unique<error_category_list<Unique...>>
+  {
+    using type = error_category_list<Unique...>;
+  };
+  template <error_category_getter... Unique, error_category_getter Head, error_category_getter... Tail>
+  struct error_category_unique<error_category_list<Unique...>, Head, Tail...>
+      : error_category_unique<std::conditional_t<(error_category_position<Head, Unique...>::value < sizeof...(Unique)), error_category_list<Unique...>, error_category_list<Unique..., Head>>, Tail...>
+  {
+  };
+  template <class To, size_t N, class List> struct error_map_type;
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class To, size_t N, error_category_getter... Categories> class error_map
+{
+  static_assert(sizeof...(Categories) > 0, "error_map needs at least one category");
+  static_assert(N > 0, "error_map needs at least one entry");
+  static_assert(std::is_trivially_copyable<To>::value && std::is_default_constructible<To>::value, "error_map can only map to trivially copyable types");
+
+  static constexpr size_t _category_count = sizeof...(Categories);
+  static constexpr size_t _slot_bits = detail::error_map_slot_bits(N);
+  static constexpr size_t _slot_count = size_t(1) << _slot_bits;
+
+  struct _slot
+  {
+    uint64_t key{0};
+    To mapped{};
+    bool used{false};
+  };
+
+  _slot _slots[_slot_count]{};
+  To _default{};
+  uint64_t _multiplier{0};
+  size_t _max_probe{0};
+
+  constexpr size_t _hash(uint64_t key) const noexcept { return static_cast<size_t>((key * _multiplier) >> (64U - _slot_bits)); }
+
+public:
+  //! The type errors are mapped to.
+  using value_type = To;
+
+  /*! Builds the table. Each entry's category is numbered by its position in `Categories`, and a
+  multiplicative hash without collisions is searched for over the (category position, value) keys.
+  If none is found within a bounded number of attempts, linear probing resolves collisions and lookup
+  probes at most `max_probe()` extra slots. Where the same key appears more than once, the first entry
+  wins.
+  */
+  template <error_category_getter... EntryCategories>
+  constexpr explicit error_map(To default_value, const error_map_entry<EntryCategories, To> &... entries) noexcept
+      : _default(default_value)
+  {
+    static_assert(sizeof...(EntryCategories) == N, "error_map<To, N> needs N entries");
+    const uint64_t keys[N] = {detail::error_map_key(_position<EntryCategories>(), entries.value)...};
+    const To mapped[N] = {entries.mapped...};
+    for(uint64_t attempt = 0; attempt < 256 && _multiplier == 0; attempt++)
+    {
+      const uint64_t multiplier = (0x9E3779B97F4A7C15ULL + attempt * 0xBF58476D1CE4E5B9ULL) | 1U;
+      _multiplier = multiplier;
+      bool taken[_slot_count]{};
+      uint64_t taken_by[_slot_count]{};
+      for(size_t n = 0; n < N; n++)
+      {
+        const size_t h = _hash(keys[n]);
+        if(taken[h] && taken_by[h] != keys[n])
+        {
+          _multiplier = 0;
+          break;
+        }
+        taken[h] = true;
+        taken_by[h] = keys[n];
+      }
+    }
+    if(_multiplier == 0)
+    {
+      _multiplier = 0x9E3779B97F4A7C15ULL;
+    }
+    for(size_t n = 0; n < N; n++)
+    {
+      size_t h = _hash(keys[n]), probe = 0;
+      while(_slots[h].used && _slots[h].key != keys[n])
+      {
+        h = (h + 1) & (_slot_count - 1);
+        ++probe;
+      }
+      if(!_slots[h].used)
+      {
+        _slots[h].key = keys[n];
+        _slots[h].mapped = mapped[n];
+        _slots[h].used = true;
+        if(probe > _max_probe)
+        {
+          _max_probe = probe;
+        }
+      }
+    }
+  }
+
+  //! The value returned for errors not in the table.
+  constexpr To default_value() const noexcept { return _default; }
+  //! The most slots beyond the first a lookup will examine, zero if the hash is perfect.
+  constexpr size_t max_probe() const noexcept { return _max_probe; }
+
+  //! Looks up the value mapped to `value` of the category returned by `Category`.
+  template <error_category_getter Category> constexpr To lookup(int value) const noexcept
+  {
+    return lookup(detail::error_category_position<Category, Categories...>::value, value);
+  }
+  //! Looks up the value mapped to `value` of the `category_index`-th of `Categories`, returning `default_value()` if there is no such category.
+  constexpr To lookup(size_t category_index, int value) const noexcept
+  {
+    if(category_index >= _category_count)
+    {
+      return _default;
+    }
+    const uint64_t key = detail::error_map_key(category_index, value);
+    size_t h = _hash(key);
+    for(size_t probe = 0; probe <= _max_probe; probe++)
+    {
+      if(_slots[h].used && _slots[h].key == key)
+      {
+        return _slots[h].mapped;
+      }
+      h = (h + 1) & (_slot_count - 1);
+    }
+    return _default;
+  }
+
+  /*! Maps an error code. The category is identified by address against the singletons returned
+  by the category getters in the table, so no virtual function of the category is ever called.
+  */
+  To operator()(const std::error_code &ec) const noexcept
+  {
+    static constexpr error_category_getter categories[] = {Categories...};
+    const std::error_category *cat = &ec.category();
+    for(size_t n = 0; n < _category_count; n++)
+    {
+      if(&categories[n]() == cat)
+      {
+        return lookup(n, ec.value());
+      }
+    }
+    return _default;
+  }
+
+private:
+  template <error_category_getter Category> static constexpr size_t _position() noexcept
+  {
+    static_assert(detail::error_category_position<Category, Categories...>::value < _category_count, "every entry's category must be one of the error_map's categories");
+    return detail::error_category_position<Category, Categories...>::value;
+  }
+};
+
+namespace detail
+{
+  template <class To, size_t N, error_category_getter... Categories> struct error_map_type<To, N, error_category_list<Categories...>>
+  {
+    using type = error_map<To, N, Categories...>;
+  };
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class To, error_category_getter... EntryCategories>
+constexpr inline typename detail::error_map_type<To, sizeof...(EntryCategories), typename detail::error_category_unique<detail::error_category_list<>, EntryCategories...>::type>::type
+make_error_map(To default_value, const error_map_entry<EntryCategories, To> &... entries) noexcept
+{
+  return typename detail::error_map_type<To, sizeof...(EntryCategories), typename detail::error_category_unique<detail::error_category_list<>, EntryCategories...>::type>::type(default_value, entries...);
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
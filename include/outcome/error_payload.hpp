@@ -0,0 +1,134 @@
+/* A per-thread ring arena of error payloads addressed by spare storage
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_ERROR_PAYLOAD_HPP
+#define OUTCOME_ERROR_PAYLOAD_HPP
+
+#include "basic_result.hpp"
+
+#include <cstddef>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class Payload, size_t Slots = 16> class error_payload_arena
+{
+  static_assert(Slots > 0 && Slots <= 32768 && (Slots & (Slots - 1)) == 0, "error_payload_arena<Payload, Slots> requires Slots to be a power of two no greater than 32768");
+
+  struct _slot
+  {
+    uint16_t handle{0};  // zero when never written
+    Payload payload{};
+  };
+  _slot _slots[Slots];
+  uint16_t _last{0};
+
+public:
+  //! The type of payload kept
+  using payload_type = Payload;
+  //! The number of payloads kept before the oldest is recycled
+  static constexpr size_t slots = Slots;
+
+  error_payload_arena() = default;
+  error_payload_arena(const error_payload_arena &) = delete;
+  error_payload_arena(error_payload_arena &&) = delete;
+  error_payload_arena &operator=(const error_payload_arena &) = delete;
+  error_payload_arena &operator=(error_payload_arena &&) = delete;
+  ~error_payload_arena() = default;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  static error_payload_arena &this_thread() noexcept
+  {
+    static thread_local error_payload_arena v;
+    return v;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class... Args>
+  uint16_t emplace(Args &&... args) noexcept(detail::is_nothrow_constructible<Payload, Args...> &&std::is_nothrow_move_assignable<Payload>::value)
+  {
+    // The handle counts every payload ever written, skipping zero which means no payload. It wraps
+    // after 65535 payloads, so a handle held across that many later payloads on this thread may be
+    // reissued, and then finds the newer payload rather than none.
+    if(++_last == 0)
+    {
+      ++_last;
+    }
+    _slot &s = _slots[_last & (Slots - 1)];
+    // If constructing the payload throws, the slot is left empty rather than claimed by a stale handle
+    s.handle = 0;
+    s.payload = Payload(static_cast<Args &&>(args)...);
+    s.handle = _last;
+    return _last;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  Payload *get(uint16_t handle) noexcept
+  {
+    // Null once the slot is recycled, but only until the handle is reissued 65535 payloads later
+    _slot &s = _slots[handle & (Slots - 1)];
+    return (handle != 0 && s.handle == handle) ? &s.payload : nullptr;
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  const Payload *get(uint16_t handle) const noexcept
+  {
+    const _slot &s = _slots[handle & (Slots - 1)];
+    return (handle != 0 && s.handle == handle) ? &s.payload : nullptr;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class R, class S, class NoValuePolicy, class... Args>
+  uint16_t attach(detail::basic_result_storage<R, S, NoValuePolicy> &r, Args &&... args) noexcept(noexcept(std::declval<error_payload_arena &>().emplace(static_cast<Args &&>(args)...)))
+  {
+    const uint16_t handle = emplace(static_cast<Args &&>(args)...);
+    hooks::set_spare_storage(&r, handle);
+    return handle;
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class R, class S, class NoValuePolicy> const Payload *find(const detail::basic_result_storage<R, S, NoValuePolicy> &r) const noexcept
+  {
+    // Handles only mean something to the arena which issued them, as every arena counts from one. A
+    // result failed on another thread must be looked up in that thread's arena, which that thread
+    // must not write to meanwhile, for example by handing the result over once it has finished.
+    return get(hooks::spare_storage(&r));
+  }
+};
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,198 @@
+/* Zero copy views between result.h's C structs and status_result
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXPERIMENTAL_C_RESULT_VIEW_HPP
+#define OUTCOME_EXPERIMENTAL_C_RESULT_VIEW_HPP
+
+#include "result.h"
+#include "status_result.hpp"
+
+#include <cstddef>
+#include <new>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace experimental
+{
+  namespace detail
+  {
+    template <class... Args> struct c_result_void
+    {
+      using type = void;
+    };
+
+    // The layout of value_storage_nontrivial, which is what a status_result stores
+    template <class T, class E> struct c_result_mirror
+    {
+      alignas(T) unsigned char value[sizeof(T)];
+      OUTCOME_V2_NAMESPACE::detail::status_bitfield_type flags;
+      alignas(E) unsigned char error[sizeof(E)];
+    };
+    // The layout of a status code
+    template <class V> struct c_status_code_mirror
+    {
+      const void *domain;
+      alignas(V) unsigned char value[sizeof(V)];
+    };
+
+    template <class CResult, class Result, class = void> struct c_result_layout_compatible
+    {
+      static constexpr bool value = false;
+    };
+    template <class CResult, class Result>
+    struct c_result_layout_compatible<CResult, Result,
+                                      typename c_result_void<decltype(std::declval<CResult &>().value), decltype(std::declval<CResult &>().flags),
+                                                             decltype(std::declval<CResult &>().error.domain), decltype(std::declval<CResult &>().error.value),
+                                                             typename Result::value_type, typename Result::error_type::value_type>::type>
+    {
+      using value_type = typename Result::value_type;
+      using error_type = typename Result::error_type;
+      using c_error_type = decltype(std::declval<CResult &>().error);
+      using c_error_value_type = decltype(std::declval<CResult &>().error.value);
+      using state_type = std::decay_t<decltype(std::declval<Result &>()._iostreams_state())>;
+      using storage_type = OUTCOME_V2_NAMESPACE::detail::value_storage_nontrivial<value_type, error_type>;
+      using mirror = c_result_mirror<value_type, error_type>;
+      using error_mirror = c_status_code_mirror<typename error_type::value_type>;
+
+      static constexpr bool value =
+      is_basic_result<Result>::value && (is_status_code<error_type>::value || is_errored_status_code<error_type>::value)
+      // The value is the very same type on both sides
+      && std::is_same<value_type, decltype(std::declval<CResult &>().value)>::value && std::is_trivially_copyable<value_type>::value
+      // The result stores its value, then its status bits, then its error
+      && std::is_base_of<storage_type, state_type>::value && sizeof(state_type) == sizeof(storage_type) && sizeof(Result) == sizeof(storage_type)
+      && sizeof(storage_type) == sizeof(mirror) && alignof(Result) == alignof(mirror)
+      // The C struct lays out the same
+      && std::is_standard_layout<CResult>::value && sizeof(CResult) == sizeof(mirror) && alignof(CResult) == alignof(mirror)
+      && offsetof(CResult, value) == offsetof(mirror, value) && offsetof(CResult, flags) == offsetof(mirror, flags)
+      && offsetof(CResult, error) == offsetof(mirror, error) && sizeof(std::declval<CResult &>().flags) == sizeof(mirror::flags)
+      // As does its status code
+      && sizeof(c_error_type) == sizeof(error_type) && alignof(c_error_type) == alignof(error_type) && sizeof(error_type) == sizeof(error_mirror)
+      && offsetof(c_error_type, domain) == offsetof(error_mirror, domain) && offsetof(c_error_type, value) == offsetof(error_mirror, value)
+      && sizeof(c_error_value_type) == sizeof(typename error_type::value_type) && std::is_integral<c_error_value_type>::value
+      && std::is_integral<typename error_type::value_type>::value;
+    };
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class CResult, class Result> struct is_c_result_layout_compatible
+  {
+    static constexpr bool value = detail::c_result_layout_compatible<CResult, Result>::value;
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class CResult, class T, class S, class NoValuePolicy> inline CResult &as_c_result(basic_result<T, S, NoValuePolicy> &r) noexcept
+  {
+    static_assert(is_c_result_layout_compatible<CResult, basic_result<T, S, NoValuePolicy>>::value,
+                  "The C result struct does not have the layout of the status_result");
+    return *reinterpret_cast<CResult *>(&r);
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class CResult, class T, class S, class NoValuePolicy> inline const CResult &as_c_result(const basic_result<T, S, NoValuePolicy> &r) noexcept
+  {
+    static_assert(is_c_result_layout_compatible<CResult, basic_result<T, S, NoValuePolicy>>::value,
+                  "The C result struct does not have the layout of the status_result");
+    return *reinterpret_cast<const CResult *>(&r);
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class Result, class CResult> inline Result &as_status_result(CResult &c) noexcept
+  {
+    static_assert(is_c_result_layout_compatible<std::remove_const_t<CResult>, std::remove_const_t<Result>>::value,
+                  "The C result struct does not have the layout of the status_result");
+    return *reinterpret_cast<Result *>(&c);
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class CResult, class T, class S, class NoValuePolicy> inline CResult *as_c_results(basic_result<T, S, NoValuePolicy> *first) noexcept
+  {
+    // Equal sizes mean that the nth C result is the nth status_result
+    return &as_c_result<CResult>(*first);
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class CResult, class T, class S, class NoValuePolicy> inline const CResult *as_c_results(const basic_result<T, S, NoValuePolicy> *first) noexcept
+  {
+    return &as_c_result<CResult>(*first);
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class Result, class CResult> inline Result *as_status_results(CResult *first) noexcept { return &as_status_result<Result>(*first); }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class CResult, class T, class S, class NoValuePolicy> inline CResult to_c_result(basic_result<T, S, NoValuePolicy> &&r) noexcept
+  {
+    using result_type = basic_result<T, S, NoValuePolicy>;
+    static_assert(is_c_result_layout_compatible<CResult, result_type>::value, "The C result struct does not have the layout of the status_result");
+    static_assert(std::is_nothrow_move_constructible<result_type>::value, "The status_result must be nothrow move constructible");
+    // The C result takes ownership of the error, leaving r to destroy nothing
+    CResult ret;
+    new(&ret) result_type(static_cast<result_type &&>(r));
+    return ret;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class Result, class CResult> inline Result from_c_result(CResult &&c) noexcept
+  {
+    static_assert(!std::is_lvalue_reference<CResult>::value, "from_c_result() takes ownership of the C result, so it must be an rvalue");
+    static_assert(std::is_nothrow_move_constructible<Result>::value, "The status_result must be nothrow move constructible");
+    // Leaves the C result with an empty error, which has nothing to destroy
+    return Result(static_cast<Result &&>(as_status_result<Result>(c)));
+  }
+
+  namespace detail
+  {
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    using c_errno_domain = posix_code::domain_type;
+#else
+    using c_errno_domain = generic_code::domain_type;
+#endif
+  }  // namespace detail
+}  // namespace experimental
+
+OUTCOME_V2_NAMESPACE_END
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+#define OUTCOME_C_RESULT_DEFINE_ERRNO_DOMAIN()                                                                                                                 \
+  extern "C" void *const cxx_status_code_errno_domain =                                                                                                        \
+  const_cast<OUTCOME_V2_NAMESPACE::experimental::detail::c_errno_domain *>(&OUTCOME_V2_NAMESPACE::experimental::detail::c_errno_domain::get())
+
+#endif
@@ -0,0 +1,185 @@
+/* A status code domain carrying a short message inline
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXPERIMENTAL_INLINE_MESSAGE_CODE_HPP
+#define OUTCOME_EXPERIMENTAL_INLINE_MESSAGE_CODE_HPP
+
+#include "status_result.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace experimental
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <size_t N> struct inline_message
+  {
+    static_assert(N >= 2 && N <= 256, "inline_message<N> requires N to be between 2 and 256");
+
+    //! The generic code which the message describes.
+    errc code{errc::success};
+    //! The length of the message, excluding the null terminator.
+    uint8_t length{0};
+    //! The message, null terminated.
+    char message[N]{};
+
+    inline_message() = default;
+    //! Copies `msg`, truncated to the last whole UTF-8 character within `N - 1` bytes.
+    inline_message(errc c, const char *msg, size_t len) noexcept
+        : code(c)
+    {
+      if(len > N - 1)
+      {
+        len = N - 1;
+        // Don't leave half a multibyte UTF-8 character on the end
+        while(len > 0 && (static_cast<unsigned char>(msg[len]) & 0xc0U) == 0x80U)
+        {
+          --len;
+        }
+      }
+      memcpy(message, msg, len);
+      message[len] = 0;
+      length = static_cast<uint8_t>(len);
+    }
+    //! Copies the null terminated `msg`, truncated to the last whole UTF-8 character within `N - 1` bytes.
+    inline_message(errc c, const char *msg) noexcept
+        : inline_message(c, msg, strlen(msg))
+    {
+    }
+  };
+
+  template <size_t N> class _inline_message_code_domain;
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <size_t N> using basic_inline_message_code = status_code<_inline_message_code_domain<N>>;
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  using inline_message_code = basic_inline_message_code<48>;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <size_t N> class _inline_message_code_domain : public status_code_domain
+  {
+    template <class DomainType> friend class SYSTEM_ERROR2_NAMESPACE::status_code;
+    template <class StatusCode> friend class SYSTEM_ERROR2_NAMESPACE::detail::indirecting_domain;
+    using _base = status_code_domain;
+    using _code_type = basic_inline_message_code<N>;
+
+  public:
+    //! The value type of the code, which holds its message.
+    using value_type = inline_message<N>;
+    using _base::string_ref;
+
+    constexpr _inline_message_code_domain() noexcept
+        : _base(0x4a1e6c0de5e7a9b1 ^ N)
+    {
+    }
+    _inline_message_code_domain(const _inline_message_code_domain &) = default;
+    _inline_message_code_domain(_inline_message_code_domain &&) = default;
+    _inline_message_code_domain &operator=(const _inline_message_code_domain &) = default;
+    _inline_message_code_domain &operator=(_inline_message_code_domain &&) = default;
+    ~_inline_message_code_domain() = default;
+
+#if __cplusplus < 201402L && !defined(_MSC_VER)
+    static inline const _inline_message_code_domain &get()
+    {
+      static _inline_message_code_domain v;
+      return v;
+    }
+#else
+    static inline constexpr const _inline_message_code_domain &get();
+#endif
+
+    virtual string_ref name() const noexcept override { return string_ref("inline message domain"); }  // NOLINT
+
+  protected:
+    virtual bool _do_failure(const status_code<void> &code) const noexcept override  // NOLINT
+    {
+      assert(code.domain() == *this);                                             // NOLINT
+      return static_cast<const _code_type &>(code).value().code != errc::success;  // NOLINT
+    }
+    // The message is diagnostic only, so codes are equivalent if their generic codes are
+    virtual bool _do_equivalent(const status_code<void> &code1, const status_code<void> &code2) const noexcept override  // NOLINT
+    {
+      assert(code1.domain() == *this);                         // NOLINT
+      const auto &c1 = static_cast<const _code_type &>(code1);  // NOLINT
+      if(code2.domain() == *this)
+      {
+        return c1.value().code == static_cast<const _code_type &>(code2).value().code;  // NOLINT
+      }
+      if(code2.domain() == generic_code_domain)
+      {
+        return c1.value().code == static_cast<const generic_code &>(code2).value();  // NOLINT
+      }
+      return false;
+    }
+    virtual generic_code _generic_code(const status_code<void> &code) const noexcept override  // NOLINT
+    {
+      assert(code.domain() == *this);                                          // NOLINT
+      return generic_code(static_cast<const _code_type &>(code).value().code);  // NOLINT
+    }
+    // The message refers to the code, and so is valid only for as long as the code is
+    virtual string_ref _do_message(const status_code<void> &code) const noexcept override  // NOLINT
+    {
+      assert(code.domain() == *this);                         // NOLINT
+      const auto &c = static_cast<const _code_type &>(code);  // NOLINT
+      return string_ref(c.value().message, c.value().length);
+    }
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(OUTCOME_STANDARDESE_IS_IN_THE_HOUSE)
+    SYSTEM_ERROR2_NORETURN virtual void _do_throw_exception(const status_code<void> &code) const override  // NOLINT
+    {
+      assert(code.domain() == *this);                         // NOLINT
+      const auto &c = static_cast<const _code_type &>(code);  // NOLINT
+      throw status_error<_inline_message_code_domain>(c);
+    }
+#endif
+  };
+
+#if __cplusplus >= 201402L || defined(_MSC_VER)
+  template <size_t N> constexpr _inline_message_code_domain<N> inline_message_code_domain = {};
+  template <size_t N> inline constexpr const _inline_message_code_domain<N> &_inline_message_code_domain<N>::get() { return inline_message_code_domain<N>; }
+#endif
+}  // namespace experimental
+
+OUTCOME_V2_NAMESPACE_END
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+namespace traits
+{
+  // The value is trivially copyable, so a moved from code need not be destroyed
+  template <size_t N> struct is_move_bitcopying<status_code<OUTCOME_V2_NAMESPACE::experimental::_inline_message_code_domain<N>>>
+  {
+    static constexpr bool value = true;
+  };
+}  // namespace traits
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -52,6 +52,10 @@ extern "C"
 
 #define CXX_RESULT_ERROR_IS_ERRNO(r) (((r).flags & (1U << 4U)) == (1U << 4U))
 
+#define CXX_RESULT_SET_VALUE(r, v) ((r).value = (v), (r).flags = 1U)
+
+#define CXX_RESULT_SET_ERROR(r, e) ((r).error = (e), (r).flags = 2U)
+
 
   /***************************** <system_error2> support ******************************/
 
@@ -91,6 +95,61 @@ extern "C"
 #define CXX_DECLARE_RESULT_SYSTEM(ident, R) CXX_DECLARE_RESULT_STATUS_CODE(system_##ident, R, struct cxx_status_code_system)
 #define CXX_RESULT_SYSTEM(ident) CXX_RESULT_STATUS_CODE(system_##ident)
 
+  /* The domain of errno codes, which is that of posix_code, or of generic_code if there is no posix_code.
+  Exactly one C++ source must define it with OUTCOME_C_RESULT_DEFINE_ERRNO_DOMAIN() from
+  <outcome/experimental/c_result_view.hpp>.
+  */
+  extern void *const cxx_status_code_errno_domain;
+
+#define CXX_RESULT_SET_ERRNO(r, e) ((r).error.domain = cxx_status_code_errno_domain, (r).error.value = (e), (r).flags = 18U)
+
+
+  /******************************** Early return **************************************/
+
+#if defined(__cplusplus)
+#define CXX_RESULT_TYPEOF(x) decltype(x)
+#elif defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1939)
+#define CXX_RESULT_TYPEOF(x) __typeof__(x)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 202311L
+#define CXX_RESULT_TYPEOF(x) typeof(x)
+#endif
+
+#ifdef CXX_RESULT_TYPEOF
+#define CXX_RESULT_TRY_GLUE2(x, y) x##y
+#define CXX_RESULT_TRY_GLUE(x, y) CXX_RESULT_TRY_GLUE2(x, y)
+#define CXX_RESULT_TRY_UNIQUE_NAME CXX_RESULT_TRY_GLUE(cxx_result_try_unique_name_temporary, __COUNTER__)
+
+#define CXX_RESULT_TRY_RETURN_ARG_COUNT(_1_, _2_, _3_, count, ...) count
+#define CXX_RESULT_TRY_EXPAND_ARGS(args) CXX_RESULT_TRY_RETURN_ARG_COUNT args
+#define CXX_RESULT_TRY_COUNT_ARGS(...) CXX_RESULT_TRY_EXPAND_ARGS((__VA_ARGS__, 3, 2, 1, 0))
+#define CXX_RESULT_TRY_OVERLOAD_MACRO2(name, count) name##count
+#define CXX_RESULT_TRY_OVERLOAD_MACRO1(name, count) CXX_RESULT_TRY_OVERLOAD_MACRO2(name, count)
+#define CXX_RESULT_TRY_OVERLOAD_MACRO(name, count) CXX_RESULT_TRY_OVERLOAD_MACRO1(name, count)
+#define CXX_RESULT_TRY_OVERLOAD_GLUE(x, y) x y
+#define CXX_RESULT_TRY_CALL_OVERLOAD(name, ...) CXX_RESULT_TRY_OVERLOAD_GLUE(CXX_RESULT_TRY_OVERLOAD_MACRO(name, CXX_RESULT_TRY_COUNT_ARGS(__VA_ARGS__)), (__VA_ARGS__))
+
+#define CXX_RESULT_TRY_FAILURE(unique, ret_type, expr)                                                                                                         \
+  CXX_RESULT_TYPEOF(expr) unique = (expr);                                                                                                                     \
+  if(!CXX_RESULT_HAS_VALUE(unique))                                                                                                                            \
+  {                                                                                                                                                            \
+    ret_type cxx_result_try_failure;                                                                                                                           \
+    cxx_result_try_failure.flags = unique.flags;                                                                                                               \
+    cxx_result_try_failure.error = unique.error;                                                                                                               \
+    return cxx_result_try_failure;                                                                                                                             \
+  }
+
+#define CXX_RESULT_TRY2_(unique, ret_type, expr) CXX_RESULT_TRY_FAILURE(unique, ret_type, expr) (void) unique
+#define CXX_RESULT_TRY3_(unique, var, ret_type, expr)                                                                                                          \
+  CXX_RESULT_TRY_FAILURE(unique, ret_type, expr) CXX_RESULT_TYPEOF(unique.value) var = unique.value
+#define CXX_RESULT_TRY2(ret_type, expr) CXX_RESULT_TRY2_(CXX_RESULT_TRY_UNIQUE_NAME, ret_type, expr)
+#define CXX_RESULT_TRY3(var, ret_type, expr) CXX_RESULT_TRY3_(CXX_RESULT_TRY_UNIQUE_NAME, var, ret_type, expr)
+
+/* Evaluates the result `expr`, returning its error from the calling function as the result type `ret_type` if
+it failed, otherwise declaring `var` if given to be its value. The error types of both results must be the same.
+*/
+#define CXX_RESULT_TRY(...) CXX_RESULT_TRY_CALL_OVERLOAD(CXX_RESULT_TRY, __VA_ARGS__)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
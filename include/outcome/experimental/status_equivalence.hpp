@@ -0,0 +1,187 @@
+/* A precomputed table of status code equivalence to errc
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXPERIMENTAL_STATUS_EQUIVALENCE_HPP
+#define OUTCOME_EXPERIMENTAL_STATUS_EQUIVALENCE_HPP
+
+#include "status_outcome.hpp"
+
+#include <atomic>
+#include <bitset>
+#include <memory>
+#include <mutex>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace experimental
+{
+  namespace detail
+  {
+    template <class T> struct is_equivalence_tabulable_value
+    {
+      static constexpr bool value = std::is_integral<T>::value || std::is_enum<T>::value;
+    };
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  class status_equivalence_table
+  {
+  public:
+    //! The most times `add()` can succeed, including replacing the table of a domain.
+    static constexpr size_t max_tables = 64;
+    //! The `errc` values below this are tabulated.
+    static constexpr int errc_limit = 256;
+
+  private:
+    // Immutable once published
+    struct domain_entry
+    {
+      status_code_domain::unique_id_type id;
+      int64_t first;
+      uint64_t count;
+      std::unique_ptr<std::bitset<errc_limit>[]> equivalent;  // indexed by value - first
+    };
+    static constexpr size_t _slot_count = max_tables * 2;
+
+    std::mutex _lock;                                   // serialises adding tables
+    std::unique_ptr<domain_entry> _entries[max_tables];  // owns every entry ever published, protected by _lock
+    size_t _entries_used{0};                            // protected by _lock
+    std::atomic<const domain_entry *> _slots[_slot_count]{};
+
+    static size_t _hash(status_code_domain::unique_id_type id) noexcept { return static_cast<size_t>(id ^ (id >> 32U)) & (_slot_count - 1); }
+
+    const domain_entry *_find(status_code_domain::unique_id_type id) const noexcept
+    {
+      for(size_t n = 0, idx = _hash(id); n < _slot_count; n++, idx = (idx + 1) & (_slot_count - 1))
+      {
+        const domain_entry *e = _slots[idx].load(std::memory_order_acquire);
+        if(e == nullptr || e->id == id)
+        {
+          return e;
+        }
+      }
+      return nullptr;
+    }
+
+  public:
+    status_equivalence_table() = default;
+    status_equivalence_table(const status_equivalence_table &) = delete;
+    status_equivalence_table &operator=(const status_equivalence_table &) = delete;
+
+    /*! Tabulates the equivalence of the values of `DomainType` from `first` up to but not including
+    `last` to each `errc` value, by asking the domain once for each. Adding a domain again replaces
+    its table. Returns false if there is no room for another table.
+    */
+    OUTCOME_TEMPLATE(class DomainType)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_equivalence_tabulable_value<typename status_code<DomainType>::value_type>::value))
+    bool add(typename status_code<DomainType>::value_type first, typename status_code<DomainType>::value_type last)
+    {
+      using value_type = typename status_code<DomainType>::value_type;
+      auto entry = std::make_unique<domain_entry>();
+      entry->id = DomainType::get().id();
+      entry->first = static_cast<int64_t>(first);
+      entry->count = static_cast<uint64_t>(static_cast<int64_t>(last) - static_cast<int64_t>(first));
+      entry->equivalent = std::make_unique<std::bitset<errc_limit>[]>(static_cast<size_t>(entry->count));
+      for(uint64_t v = 0; v < entry->count; v++)
+      {
+        const status_code<DomainType> code(SYSTEM_ERROR2_NAMESPACE::in_place, static_cast<value_type>(entry->first + static_cast<int64_t>(v)));
+        for(int e = 0; e < errc_limit; e++)
+        {
+          entry->equivalent[v][e] = code.equivalent(generic_code(static_cast<errc>(e)));
+        }
+      }
+      std::lock_guard<std::mutex> g(_lock);
+      if(_entries_used == max_tables)
+      {
+        return false;
+      }
+      const domain_entry *e = entry.get();
+      // With at most half the slots used, probing always finds the slot of the domain or a free one
+      for(size_t idx = _hash(e->id);; idx = (idx + 1) & (_slot_count - 1))
+      {
+        const domain_entry *existing = _slots[idx].load(std::memory_order_relaxed);
+        if(existing == nullptr || existing->id == e->id)
+        {
+          // Readers may still be using a replaced entry, so it is kept until destruction
+          _entries[_entries_used++] = std::move(entry);
+          _slots[idx].store(e, std::memory_order_release);
+          return true;
+        }
+      }
+    }
+
+    /*! Returns whether `sc` is equivalent to `e`. If the domain of `sc` was added, and its value
+    and `e` are within the table, this is a lookup without calling the domain. Otherwise the domains
+    are asked, as by `sc == e`.
+    */
+    OUTCOME_TEMPLATE(class DomainType)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_equivalence_tabulable_value<typename status_code<DomainType>::value_type>::value))
+    bool equivalent(const status_code<DomainType> &sc, errc e) const noexcept
+    {
+      const int eidx = static_cast<int>(e);
+      if(!sc.empty() && eidx >= 0 && eidx < errc_limit)
+      {
+        const domain_entry *d = _find(sc.domain().id());
+        if(d != nullptr)
+        {
+          const uint64_t idx = static_cast<uint64_t>(static_cast<int64_t>(sc.value()) - d->first);
+          if(idx < d->count)
+          {
+            return d->equivalent[idx][static_cast<size_t>(eidx)];
+          }
+        }
+      }
+      return sc.equivalent(generic_code(e));
+    }
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline status_equivalence_table &status_equivalences() noexcept
+  {
+    static status_equivalence_table v;
+    return v;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class DomainType)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_equivalence_tabulable_value<typename status_code<DomainType>::value_type>::value))
+  inline bool is_equivalent(const status_code<DomainType> &sc, errc e) noexcept { return status_equivalences().equivalent(sc, e); }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class T, class S, class NoValuePolicy)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(is_status_code<S>::value || is_errored_status_code<S>::value))
+  inline bool is_equivalent(const basic_result<T, S, NoValuePolicy> &r, errc e) noexcept { return r.has_error() && is_equivalent(r.assume_error(), e); }
+}  // namespace experimental
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,278 @@
+/* An interning cache of status code messages
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXPERIMENTAL_STATUS_MESSAGE_CACHE_HPP
+#define OUTCOME_EXPERIMENTAL_STATUS_MESSAGE_CACHE_HPP
+
+#include "status_outcome.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace experimental
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  template <class DomainType> struct is_message_cacheable_domain : std::false_type
+  {
+  };
+  template <> struct is_message_cacheable_domain<_generic_code_domain> : std::true_type
+  {
+  };
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+  template <> struct is_message_cacheable_domain<_posix_code_domain> : std::true_type
+  {
+  };
+#endif
+#ifdef _WIN32
+  template <> struct is_message_cacheable_domain<_win32_code_domain> : std::true_type
+  {
+  };
+  template <> struct is_message_cacheable_domain<_nt_code_domain> : std::true_type
+  {
+  };
+#endif
+
+  namespace detail
+  {
+    // Messages are interned by the bits of the value, so only codes whose value is all there is to them
+    template <class T> struct is_message_cacheable_value
+    {
+      static constexpr bool value = (std::is_integral<T>::value || std::is_enum<T>::value) && sizeof(T) <= sizeof(uint64_t);
+    };
+    template <class DomainType> struct is_message_cacheable_code
+    {
+      static constexpr bool value = is_message_cacheable_domain<DomainType>::value && is_message_cacheable_value<typename DomainType::value_type>::value;
+    };
+    // Erased codes may hold any domain, including those whose value points elsewhere such as
+    // status_code_ptr's, so only the value only domains of status code are recognised
+    template <class ErasedType> struct is_message_cacheable_code<erased<ErasedType>>
+    {
+      static constexpr bool value = is_message_cacheable_value<ErasedType>::value;
+    };
+    inline bool is_message_cacheable_domain_id(status_code_domain::unique_id_type id) noexcept
+    {
+      return id == _generic_code_domain::get().id()
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+             || id == _posix_code_domain::get().id()
+#endif
+#ifdef _WIN32
+             || id == _win32_code_domain::get().id() || id == _nt_code_domain::get().id()
+#endif
+      ;
+    }
+    template <class DomainType> inline bool is_message_cacheable(const status_code<DomainType> & /*unused*/) noexcept { return true; }
+    template <class ErasedType> inline bool is_message_cacheable(const status_code<erased<ErasedType>> &sc) noexcept
+    {
+      return !sc.empty() && is_message_cacheable_domain_id(sc.domain().id());
+    }
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  class status_message_cache
+  {
+  public:
+    using string_ref = status_code_domain::string_ref;
+    //! The slots of the cache if not specified.
+    static constexpr size_t default_slots = 4096;
+
+  private:
+    // Immutable once published. The message follows the entry, null terminated.
+    struct entry
+    {
+      status_code_domain::unique_id_type domain_id;
+      uint64_t value;
+      size_t length;
+
+      const char *message() const noexcept { return reinterpret_cast<const char *>(this + 1); }
+    };
+    static constexpr size_t _max_probes = 16;
+
+    size_t _mask;
+    std::unique_ptr<std::atomic<const entry *>[]> _slots;
+
+    static size_t _hash(status_code_domain::unique_id_type domain_id, uint64_t value) noexcept
+    {
+      uint64_t h = domain_id ^ (value * 0x9e3779b97f4a7c15ULL);
+      h ^= h >> 29U;
+      return static_cast<size_t>(h);
+    }
+
+    string_ref _message(const status_code<void> &sc, uint64_t value) noexcept
+    {
+      if(sc.empty())
+      {
+        return sc.message();
+      }
+      const status_code_domain::unique_id_type domain_id = sc.domain().id();
+      size_t idx = _hash(domain_id, value) & _mask;
+      size_t n = 0;
+      for(; n < _max_probes; n++, idx = (idx + 1) & _mask)
+      {
+        const entry *e = _slots[idx].load(std::memory_order_acquire);
+        if(e == nullptr)
+        {
+          break;
+        }
+        if(e->domain_id == domain_id && e->value == value)
+        {
+          return string_ref(e->message(), e->length);
+        }
+      }
+      // Not cached, so ask the domain and intern the answer in the first free slot
+      string_ref msg = sc.message();
+      if(n == _max_probes)
+      {
+        return msg;
+      }
+      auto *interned = static_cast<entry *>(::malloc(sizeof(entry) + msg.size() + 1));  // NOLINT
+      if(interned == nullptr)
+      {
+        return msg;
+      }
+      interned->domain_id = domain_id;
+      interned->value = value;
+      interned->length = msg.size();
+      memcpy(const_cast<char *>(interned->message()), msg.data(), msg.size());
+      const_cast<char *>(interned->message())[msg.size()] = 0;
+      for(; n < _max_probes; n++, idx = (idx + 1) & _mask)
+      {
+        const entry *expected = nullptr;
+        if(_slots[idx].compare_exchange_strong(expected, interned, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+          return string_ref(interned->message(), interned->length);
+        }
+        if(expected->domain_id == domain_id && expected->value == value)
+        {
+          // Another thread interned it first
+          ::free(interned);  // NOLINT
+          return string_ref(expected->message(), expected->length);
+        }
+      }
+      ::free(interned);  // NOLINT
+      return msg;
+    }
+
+  public:
+    //! Constructs a cache of `slots` entries, rounded up to a power of two.
+    explicit status_message_cache(size_t slots = default_slots)
+        : _mask([](size_t v) {
+          size_t ret = 1;
+          while(ret < v)
+          {
+            ret <<= 1U;
+          }
+          return ret - 1;
+        }(slots))
+        , _slots(new std::atomic<const entry *>[_mask + 1])
+    {
+      for(size_t n = 0; n <= _mask; n++)
+      {
+        _slots[n].store(nullptr, std::memory_order_relaxed);
+      }
+    }
+    status_message_cache(const status_message_cache &) = delete;
+    status_message_cache &operator=(const status_message_cache &) = delete;
+    //! Frees the interned messages. No message returned may still be in use.
+    ~status_message_cache()
+    {
+      for(size_t n = 0; n <= _mask; n++)
+      {
+        ::free(const_cast<entry *>(_slots[n].load(std::memory_order_relaxed)));  // NOLINT
+      }
+    }
+
+    /*! Returns the message of `sc`. The first time the message of a value of a domain is asked
+    for, the domain is asked for it and it is copied into the cache. Thereafter it is returned
+    from the cache without calling the domain, as a `string_ref` to the copy which does no
+    reference counting. The message of a value must therefore not change for the life of the
+    cache. Should the cache be full, the domain is asked every time.
+
+    Only domains for which `is_message_cacheable_domain<DomainType>` is true, whose message is
+    determined by the value alone, are cached. The message of an erased code is cached only if
+    its domain is one of status code's own such domains, otherwise the domain is asked every time.
+    */
+    OUTCOME_TEMPLATE(class DomainType)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_message_cacheable_code<DomainType>::value))
+    string_ref message(const status_code<DomainType> &sc) noexcept
+    {
+      if(!detail::is_message_cacheable(sc))
+      {
+        return sc.message();
+      }
+      using value_type = typename status_code<DomainType>::value_type;
+      const value_type v = sc.value();
+      uint64_t bits = 0;
+      memcpy(&bits, &v, sizeof(v));
+      return _message(sc, bits);
+    }
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  inline status_message_cache &status_messages() noexcept
+  {
+    static status_message_cache v;
+    return v;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class DomainType)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::is_message_cacheable_code<DomainType>::value))
+  inline status_message_cache::string_ref cached_message(const status_code<DomainType> &sc) noexcept { return status_messages().message(sc); }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class T, class S, class NoValuePolicy)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(is_status_code<S>::value || is_errored_status_code<S>::value))
+  inline status_message_cache::string_ref cached_message(const basic_result<T, S, NoValuePolicy> &r) noexcept
+  {
+    return r.has_error() ? cached_message(r.assume_error()) : status_message_cache::string_ref("");
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class T, class S, class P, class NoValuePolicy)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(is_status_code<S>::value || is_errored_status_code<S>::value))
+  inline status_message_cache::string_ref cached_message(const basic_outcome<T, S, P, NoValuePolicy> &o) noexcept
+  {
+    return o.has_error() ? cached_message(o.assume_error()) : status_message_cache::string_ref("");
+  }
+}  // namespace experimental
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
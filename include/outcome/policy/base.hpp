@@ -89,11 +89,19 @@ SIGNATURE NOT RECOGNISED
   {
     template <class... Args> static constexpr void _silence_unused(Args &&... /*unused*/) noexcept {}
   protected:
+    // Policies which throw do so from out of line, cold, noreturn _throw_no_*() members, so the inlined
+    // wide checks in the observers reduce to a compare and a branch. Those throwing an exception type
+    // constructed from a message share these, the others define their own _throw_no_value().
+    template <class Exception> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_value() { OUTCOME_THROW_EXCEPTION(Exception("no value")); }          // NOLINT
+    template <class Exception> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_error() { OUTCOME_THROW_EXCEPTION(Exception("no error")); }          // NOLINT
+    template <class Exception> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_exception() { OUTCOME_THROW_EXCEPTION(Exception("no exception")); }  // NOLINT
+
     template <class Impl> static constexpr void _make_ub(Impl &&self) noexcept { return detail::make_ub(static_cast<Impl &&>(self)); }
     template <class Impl> static constexpr bool _has_value(Impl &&self) noexcept { return self._state._status.have_value(); }
     template <class Impl> static constexpr bool _has_error(Impl &&self) noexcept { return self._state._status.have_error(); }
     template <class Impl> static constexpr bool _has_exception(Impl &&self) noexcept { return self._state._status.have_exception(); }
     template <class Impl> static constexpr bool _has_error_is_errno(Impl &&self) noexcept { return self._state._status.have_error_is_errno(); }
+    template <class Impl> static constexpr auto &_status_bitfield(Impl &&self) noexcept { return self._state._status; }
 
     template <class Impl> static constexpr void _set_has_value(Impl &&self, bool v) noexcept { self._state._status.set_have_value(v); }
     template <class Impl> static constexpr void _set_has_error(Impl &&self, bool v) noexcept { self._state._status.set_have_error(v); }
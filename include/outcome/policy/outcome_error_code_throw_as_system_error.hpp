@@ -40,32 +40,37 @@ type definition  error_code_throw_as_system_error. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        if(base::_has_exception(std::forward<Impl>(self)))
-        {
-          detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, error_code_throw_as_system_error>(std::forward<Impl>(self))};  // NOLINT
-        }
-        if(base::_has_error(std::forward<Impl>(self)))
-        {
-          // ADL discovered
-          outcome_throw_as_system_error_with_payload(base::_error(std::forward<Impl>(self)));
-        }
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value"));  // NOLINT
+        _throw_no_value(std::forward<Impl>(self));
       }
     }
     template <class Impl> static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no error"));  // NOLINT
+        _throw_no_error<bad_outcome_access>();
       }
     }
     template <class Impl> static constexpr void wide_exception_check(Impl &&self)
     {
       if(!base::_has_exception(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no exception"));  // NOLINT
+        _throw_no_exception<bad_outcome_access>();
       }
     }
+
+    template <class Impl> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_value(Impl &&self)
+    {
+      if(base::_has_exception(std::forward<Impl>(self)))
+      {
+        detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, error_code_throw_as_system_error>(std::forward<Impl>(self))};  // NOLINT
+      }
+      if(base::_has_error(std::forward<Impl>(self)))
+      {
+        // ADL discovered
+        outcome_throw_as_system_error_with_payload(base::_error(std::forward<Impl>(self)));
+      }
+      OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value"));  // NOLINT
+    }
   };
 }  // namespace policy
 
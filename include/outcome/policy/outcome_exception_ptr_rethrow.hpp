@@ -40,31 +40,36 @@ type definition  exception_ptr_rethrow. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        if(base::_has_exception(std::forward<Impl>(self)))
-        {
-          detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, exception_ptr_rethrow>(std::forward<Impl>(self))};
-        }
-        if(base::_has_error(std::forward<Impl>(self)))
-        {
-          detail::_rethrow_exception<trait::is_exception_ptr_available<EC>::value>{base::_error(std::forward<Impl>(self))};
-        }
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value"));  // NOLINT
+        _throw_no_value(std::forward<Impl>(self));
       }
     }
     template <class Impl> static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no error"));  // NOLINT
+        _throw_no_error<bad_outcome_access>();
       }
     }
     template <class Impl> static constexpr void wide_exception_check(Impl &&self)
     {
       if(!base::_has_exception(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no exception"));  // NOLINT
+        _throw_no_exception<bad_outcome_access>();
       }
     }
+
+    template <class Impl> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_value(Impl &&self)
+    {
+      if(base::_has_exception(std::forward<Impl>(self)))
+      {
+        detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, exception_ptr_rethrow>(std::forward<Impl>(self))};
+      }
+      if(base::_has_error(std::forward<Impl>(self)))
+      {
+        detail::_rethrow_exception<trait::is_exception_ptr_available<EC>::value>{base::_error(std::forward<Impl>(self))};
+      }
+      OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value"));  // NOLINT
+    }
   };
 }  // namespace policy
 
@@ -42,21 +42,26 @@ SIGNATURE NOT RECOGNISED
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        if(base::_has_error(std::forward<Impl>(self)))
-        {
-          // ADL
-          rethrow_exception(policy::exception_ptr(base::_error(std::forward<Impl>(self))));
-        }
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no value"));  // NOLINT
+        _throw_no_value(std::forward<Impl>(self));
       }
     }
     template <class Impl> static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no error"));  // NOLINT
+        _throw_no_error<bad_result_access>();
       }
     }
+
+    template <class Impl> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_value(Impl &&self)
+    {
+      if(base::_has_error(std::forward<Impl>(self)))
+      {
+        // ADL
+        rethrow_exception(policy::exception_ptr(base::_error(std::forward<Impl>(self))));
+      }
+      OUTCOME_THROW_EXCEPTION(bad_result_access("no value"));  // NOLINT
+    }
   };
 }  // namespace policy
 
@@ -41,23 +41,24 @@ type definition  throw_bad_result_access. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value"));  // NOLINT
+        _throw_no_value<bad_outcome_access>();
       }
     }
     template <class Impl> static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no error"));  // NOLINT
+        _throw_no_error<bad_outcome_access>();
       }
     }
     template <class Impl> static constexpr void wide_exception_check(Impl &&self)
     {
       if(!base::_has_exception(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no exception"));  // NOLINT
+        _throw_no_exception<bad_outcome_access>();
       }
     }
+
   };
   template <class EC> struct throw_bad_result_access<EC, void> : base
   {
@@ -65,19 +66,24 @@ type definition  throw_bad_result_access. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        if(base::_has_error(std::forward<Impl>(self)))
-        {
-          OUTCOME_THROW_EXCEPTION(bad_result_access_with<EC>(base::_error(std::forward<Impl>(self))));
-        }
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no value"));  // NOLINT
+        _throw_no_value(std::forward<Impl>(self));
       }
     }
     template <class Impl> static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no error"));  // NOLINT
+        _throw_no_error<bad_result_access>();
+      }
+    }
+
+    template <class Impl> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_value(Impl &&self)
+    {
+      if(base::_has_error(std::forward<Impl>(self)))
+      {
+        OUTCOME_THROW_EXCEPTION(bad_result_access_with<EC>(base::_error(std::forward<Impl>(self))));
       }
+      OUTCOME_THROW_EXCEPTION(bad_result_access("no value"));  // NOLINT
     }
   };
 }  // namespace policy
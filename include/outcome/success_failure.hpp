@@ -260,6 +260,89 @@ SIGNATURE NOT RECOGNISED
 */
 template <class T> static constexpr bool is_failure_type = detail::is_failure_type<std::decay_t<T>>::value;
 
+namespace detail
+{
+  // Errors are converted to the result's error type at the site, either directly or via ADL discovered make_error_code()
+  OUTCOME_TEMPLATE(class ErrorType, class EC)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_constructible<ErrorType, EC>::value))
+  constexpr inline ErrorType outline_failure_error(EC &&v) { return ErrorType(static_cast<EC &&>(v)); }
+  OUTCOME_TEMPLATE(class ErrorType, class EC)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_constructible<ErrorType, EC>::value && std::is_constructible<ErrorType, decltype(make_error_code(std::declval<EC>()))>::value))
+  constexpr inline ErrorType outline_failure_error(EC &&v) { return ErrorType(make_error_code(static_cast<EC &&>(v))); }
+
+  template <class Result, class EC, class = void> struct can_outline_failure
+  {
+    static constexpr bool value = false;
+  };
+  template <class Result, class EC>
+  struct can_outline_failure<Result, EC, decltype((void) outline_failure_error<typename Result::error_type>(std::declval<EC>()))>
+  {
+    static constexpr bool value = std::is_constructible<Result, failure_type<typename Result::error_type>>::value;
+  };
+
+  /* The one place per result type where a failure is constructed. Every site which
+  returns an outlined failure calls this, rather than inlining the converting
+  constructor, hooks and status bit setting into the caller.
+  */
+  template <class Result> OUTCOME_NOINLINE Result make_failure_thunk(typename Result::error_type e, uint16_t spare_storage)
+  {
+    return Result(failure_type<typename Result::error_type>(static_cast<typename Result::error_type &&>(e), spare_storage));
+  }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class EC> struct OUTCOME_NODISCARD outlined_failure_type
+{
+  using error_type = EC;
+
+private:
+  error_type _error;
+  uint16_t _spare_storage{0};
+
+public:
+  OUTCOME_TEMPLATE(class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_same<outlined_failure_type, std::decay_t<U>>::value))
+  constexpr explicit outlined_failure_type(U &&u, uint16_t spare_storage = 0)
+      : _error(static_cast<U &&>(u))  // NOLINT
+      , _spare_storage(spare_storage)
+  {
+  }
+
+  constexpr const error_type &error() const & { return _error; }
+  constexpr error_type &&error() && { return static_cast<error_type &&>(_error); }
+  constexpr uint16_t spare_storage() const { return _spare_storage; }
+
+  //! Converts into any `Result` constructible from `failure_type<Result::error_type>` via a single out of line function per `Result`.
+  OUTCOME_TEMPLATE(class Result)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::can_outline_failure<Result, const error_type &>::value))
+  operator Result() const & { return detail::make_failure_thunk<Result>(detail::outline_failure_error<typename Result::error_type>(_error), _spare_storage); }
+  //! Converts into any `Result` constructible from `failure_type<Result::error_type>` via a single out of line function per `Result`.
+  OUTCOME_TEMPLATE(class Result)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(detail::can_outline_failure<Result, error_type &&>::value))
+  operator Result() &&
+  {
+    return detail::make_failure_thunk<Result>(detail::outline_failure_error<typename Result::error_type>(static_cast<error_type &&>(_error)), _spare_storage);
+  }
+};
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+OUTCOME_TEMPLATE(class EC)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(!is_failure_type<EC>))
+inline constexpr outlined_failure_type<std::decay_t<EC>> outline_failure(EC &&v, uint16_t spare_storage = 0)
+{
+  return outlined_failure_type<std::decay_t<EC>>{static_cast<EC &&>(v), spare_storage};
+}
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class EC> inline constexpr outlined_failure_type<EC> outline_failure(failure_type<EC, void> v)
+{
+  return outlined_failure_type<EC>{static_cast<failure_type<EC, void> &&>(v).error(), v.spare_storage()};
+}
+
 OUTCOME_V2_NAMESPACE_END
 
 #endif
@@ -132,6 +132,25 @@ constexpr inline decltype(auto) try_operation_extract_value(T &&v, detail::value
   return static_cast<T &&>(v).value();
 }
 
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class Mapper, class EC>
+constexpr inline auto try_operation_map_failure(Mapper &&mapper, failure_type<EC, void> &&f)
+-> failure_type<std::decay_t<decltype(mapper(static_cast<failure_type<EC, void> &&>(f).error()))>>
+{
+  return failure(mapper(static_cast<failure_type<EC, void> &&>(f).error()), f.spare_storage());
+}
+
+namespace detail
+{
+  template <class T> constexpr inline T &&outline_try_failure(T &&v) noexcept { return static_cast<T &&>(v); }
+  template <class EC> constexpr inline outlined_failure_type<EC> outline_try_failure(failure_type<EC, void> &&v)
+  {
+    return outline_failure(static_cast<failure_type<EC, void> &&>(v));
+  }
+}  // namespace detail
+
 OUTCOME_V2_NAMESPACE_END
 
 #if !defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 8
@@ -174,6 +193,16 @@ OUTCOME_V2_NAMESPACE_END
 #endif
 #endif
 
+#ifndef OUTCOME_OUTLINE_TRY_FAILURES
+#define OUTCOME_OUTLINE_TRY_FAILURES 0
+#endif
+#if OUTCOME_OUTLINE_TRY_FAILURES
+// Each TRY failure path calls one out of line constructor per result type instead of inlining it
+#define OUTCOME_TRYV2_RETURN_AS(...) ::OUTCOME_V2_NAMESPACE::detail::outline_try_failure(__VA_ARGS__)
+#else
+#define OUTCOME_TRYV2_RETURN_AS(...) __VA_ARGS__
+#endif
+
 #define OUTCOME_TRYV2_UNIQUE_STORAGE_UNPACK(...) __VA_ARGS__
 #define OUTCOME_TRYV2_UNIQUE_STORAGE_DEDUCE3(unique, ...) auto unique = (__VA_ARGS__)
 #define OUTCOME_TRYV2_UNIQUE_STORAGE_DEDUCE2(x) x
@@ -192,11 +221,17 @@ OUTCOME_V2_NAMESPACE_END
 #define OUTCOME_TRYV2_SUCCESS_LIKELY(unique, retstmt, spec, ...)                                                                                               \
   OUTCOME_TRYV2_UNIQUE_STORAGE(unique, spec, __VA_ARGS__);                                                                                                     \
   OUTCOME_TRY_LIKELY_IF(::OUTCOME_V2_NAMESPACE::try_operation_has_value(unique));                                                                                \
-  else retstmt ::OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(unique) &&>(unique))
+  else retstmt OUTCOME_TRYV2_RETURN_AS(::OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(unique) &&>(unique)))
 #define OUTCOME_TRYV3_FAILURE_LIKELY(unique, retstmt, spec, ...)                                                                                               \
   OUTCOME_TRYV2_UNIQUE_STORAGE(unique, spec, __VA_ARGS__);                                                                                                     \
   OUTCOME_TRY_LIKELY_IF(!OUTCOME_V2_NAMESPACE::try_operation_has_value(unique))                                                                                \
-  retstmt ::OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(unique) &&>(unique))
+  retstmt OUTCOME_TRYV2_RETURN_AS(::OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(unique) &&>(unique)))
+
+#define OUTCOME_TRYV2_MAP_SUCCESS_LIKELY(unique, retstmt, mapper, spec, ...)                                                                                  \
+  OUTCOME_TRYV2_UNIQUE_STORAGE(unique, spec, __VA_ARGS__);                                                                                                     \
+  OUTCOME_TRY_LIKELY_IF(::OUTCOME_V2_NAMESPACE::try_operation_has_value(unique));                                                                                \
+  else retstmt OUTCOME_TRYV2_RETURN_AS(                                                                                                                        \
+  ::OUTCOME_V2_NAMESPACE::try_operation_map_failure(mapper, ::OUTCOME_V2_NAMESPACE::try_operation_return_as(static_cast<decltype(unique) &&>(unique))))
 
 #define OUTCOME_TRY2_VAR_SECOND2(x, var) var
 #define OUTCOME_TRY2_VAR_SECOND3(x, y, ...) x y
@@ -208,6 +243,10 @@ OUTCOME_V2_NAMESPACE_END
   OUTCOME_TRYV3_FAILURE_LIKELY(unique, retstmt, var, __VA_ARGS__);                                                                                             \
   OUTCOME_TRY2_VAR(var) = ::OUTCOME_V2_NAMESPACE::try_operation_extract_value(static_cast<decltype(unique) &&>(unique))
 
+#define OUTCOME_TRY2_MAP_SUCCESS_LIKELY(unique, retstmt, mapper, var, ...)                                                                                    \
+  OUTCOME_TRYV2_MAP_SUCCESS_LIKELY(unique, retstmt, mapper, var, __VA_ARGS__);                                                                                 \
+  OUTCOME_TRY2_VAR(var) = ::OUTCOME_V2_NAMESPACE::try_operation_extract_value(static_cast<decltype(unique) &&>(unique))
+
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
@@ -247,8 +286,9 @@ SIGNATURE NOT RECOGNISED
 
 #if defined(__GNUC__) || defined(__clang__)
 
+// __extension__ keeps the statement expression legal under -pedantic-errors without changing codegen
 #define OUTCOME_TRYX2(unique, retstmt, ...)                                                                                                                    \
-  ({                                                                                                                                                           \
+  __extension__({                                                                                                                                              \
     OUTCOME_TRYV2_SUCCESS_LIKELY(unique, retstmt, deduce, __VA_ARGS__);                                                                                        \
     ::OUTCOME_V2_NAMESPACE::try_operation_extract_value(static_cast<decltype(unique) &&>(unique));                                                               \
   })
@@ -342,6 +382,48 @@ SIGNATURE NOT RECOGNISED
 #define OUTCOME_CO_TRY_FAILURE_LIKELY(...) OUTCOME_TRY_CALL_OVERLOAD(OUTCOME_CO_TRY_FAILURE_LIKELY_INVOKE_TRY, __VA_ARGS__)
 
 
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+#define OUTCOME_TRYV_MAP(mapper, ...) OUTCOME_TRYV2_MAP_SUCCESS_LIKELY(OUTCOME_TRY_UNIQUE_NAME, return, mapper, deduce, __VA_ARGS__)
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+#define OUTCOME_TRYA_MAP(mapper, v, ...) OUTCOME_TRY2_MAP_SUCCESS_LIKELY(OUTCOME_TRY_UNIQUE_NAME, return, mapper, v, __VA_ARGS__)
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+#define OUTCOME_CO_TRYV_MAP(mapper, ...) OUTCOME_TRYV2_MAP_SUCCESS_LIKELY(OUTCOME_TRY_UNIQUE_NAME, co_return, mapper, deduce, __VA_ARGS__)
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+#define OUTCOME_CO_TRYA_MAP(mapper, v, ...) OUTCOME_TRY2_MAP_SUCCESS_LIKELY(OUTCOME_TRY_UNIQUE_NAME, co_return, mapper, v, __VA_ARGS__)
+
+#define OUTCOME_TRY_MAP_INVOKE_TRY8(m, a, b, c, d, e, f, g) OUTCOME_TRYA_MAP(m, a, b, c, d, e, f, g)
+#define OUTCOME_TRY_MAP_INVOKE_TRY7(m, a, b, c, d, e, f) OUTCOME_TRYA_MAP(m, a, b, c, d, e, f)
+#define OUTCOME_TRY_MAP_INVOKE_TRY6(m, a, b, c, d, e) OUTCOME_TRYA_MAP(m, a, b, c, d, e)
+#define OUTCOME_TRY_MAP_INVOKE_TRY5(m, a, b, c, d) OUTCOME_TRYA_MAP(m, a, b, c, d)
+#define OUTCOME_TRY_MAP_INVOKE_TRY4(m, a, b, c) OUTCOME_TRYA_MAP(m, a, b, c)
+#define OUTCOME_TRY_MAP_INVOKE_TRY3(m, a, b) OUTCOME_TRYA_MAP(m, a, b)
+#define OUTCOME_TRY_MAP_INVOKE_TRY2(m, a) OUTCOME_TRYV_MAP(m, a)
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+#define OUTCOME_TRY_MAP(...) OUTCOME_TRY_CALL_OVERLOAD(OUTCOME_TRY_MAP_INVOKE_TRY, __VA_ARGS__)
+
+#define OUTCOME_CO_TRY_MAP_INVOKE_TRY8(m, a, b, c, d, e, f, g) OUTCOME_CO_TRYA_MAP(m, a, b, c, d, e, f, g)
+#define OUTCOME_CO_TRY_MAP_INVOKE_TRY7(m, a, b, c, d, e, f) OUTCOME_CO_TRYA_MAP(m, a, b, c, d, e, f)
+#define OUTCOME_CO_TRY_MAP_INVOKE_TRY6(m, a, b, c, d, e) OUTCOME_CO_TRYA_MAP(m, a, b, c, d, e)
+#define OUTCOME_CO_TRY_MAP_INVOKE_TRY5(m, a, b, c, d) OUTCOME_CO_TRYA_MAP(m, a, b, c, d)
+#define OUTCOME_CO_TRY_MAP_INVOKE_TRY4(m, a, b, c) OUTCOME_CO_TRYA_MAP(m, a, b, c)
+#define OUTCOME_CO_TRY_MAP_INVOKE_TRY3(m, a, b) OUTCOME_CO_TRYA_MAP(m, a, b)
+#define OUTCOME_CO_TRY_MAP_INVOKE_TRY2(m, a) OUTCOME_CO_TRYV_MAP(m, a)
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+#define OUTCOME_CO_TRY_MAP(...) OUTCOME_TRY_CALL_OVERLOAD(OUTCOME_CO_TRY_MAP_INVOKE_TRY, __VA_ARGS__)
+
+
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
@@ -0,0 +1,257 @@
+/* Early exit scan over a contiguous batch of results
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_TRY_ALL_HPP
+#define OUTCOME_TRY_ALL_HPP
+
+#include "basic_result.hpp"
+
+#include <climits>
+#include <cstddef>
+#include <cstring>  // for memcpy
+#include <iterator>
+
+#ifndef OUTCOME_TRY_ALL_USE_SIMD
+#if defined(__AVX2__)
+#define OUTCOME_TRY_ALL_USE_SIMD 2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OUTCOME_TRY_ALL_USE_SIMD 1
+#else
+#define OUTCOME_TRY_ALL_USE_SIMD 0
+#endif
+#endif
+#if OUTCOME_TRY_ALL_USE_SIMD >= 2
+#include <immintrin.h>
+#elif OUTCOME_TRY_ALL_USE_SIMD >= 1
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  // policy::base is the only thing allowed to poke at the status bits of a result
+  struct try_all_status_access : policy::base
+  {
+    template <class Result> static const char *status(Result &r) noexcept { return reinterpret_cast<const char *>(&policy::base::_status_bitfield(r)); }
+  };
+
+  inline unsigned try_all_lowest_bit(unsigned v) noexcept
+  {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long ret;
+    _BitScanForward(&ret, v);
+    return static_cast<unsigned>(ret);
+#else
+    return static_cast<unsigned>(__builtin_ctz(v));
+#endif
+  }
+
+  inline unsigned try_all_load_status(const char *p) noexcept
+  {
+    uint16_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+  }
+
+  /* Returns the index of the first of `n` status bitfields spaced `stride` bytes apart
+  starting at `p` which does not have a value, or `n` if all of them have values.
+
+  Each block of eight (or four) is reduced to a bitmask without branching, so the loop
+  only branches once per block, and once more to exit.
+  */
+  inline size_t try_all_first_without_value(const char *p, size_t stride, size_t n) noexcept
+  {
+    static constexpr unsigned have_value = static_cast<unsigned>(status::have_value);
+    size_t idx = 0;
+#if OUTCOME_TRY_ALL_USE_SIMD >= 2
+    if(stride <= INT_MAX / 8)
+    {
+      const __m256i mask = _mm256_set1_epi32(static_cast<int>(have_value));
+      const __m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(stride)));
+      for(; idx + 8 <= n; idx += 8)
+      {
+        // The status bitfield is four bytes, so a dword gather stays inside each result
+        const __m256i s = _mm256_i32gather_epi32(reinterpret_cast<const int *>(p + idx * stride), offsets, 1);
+        const __m256i ok = _mm256_cmpeq_epi32(_mm256_and_si256(s, mask), mask);
+        const unsigned failed = ~static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(ok))) & 0xffU;
+        if(failed != 0)
+        {
+          return idx + try_all_lowest_bit(failed);
+        }
+      }
+    }
+#elif OUTCOME_TRY_ALL_USE_SIMD >= 1
+    {
+      const __m128i mask = _mm_set1_epi32(static_cast<int>(have_value));
+      for(; idx + 4 <= n; idx += 4)
+      {
+        const char *b = p + idx * stride;
+        const __m128i s = _mm_setr_epi32(static_cast<int>(try_all_load_status(b)), static_cast<int>(try_all_load_status(b + stride)),
+                                         static_cast<int>(try_all_load_status(b + 2 * stride)), static_cast<int>(try_all_load_status(b + 3 * stride)));
+        const __m128i ok = _mm_cmpeq_epi32(_mm_and_si128(s, mask), mask);
+        const unsigned failed = ~static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(ok))) & 0xfU;
+        if(failed != 0)
+        {
+          return idx + try_all_lowest_bit(failed);
+        }
+      }
+    }
+#else
+    for(; idx + 8 <= n; idx += 8)
+    {
+      const char *b = p + idx * stride;
+      unsigned failed = 0;
+      for(unsigned i = 0; i < 8; i++)
+      {
+        failed |= ((try_all_load_status(b + i * stride) & have_value) ^ have_value) << i;
+      }
+      if(failed != 0)
+      {
+        return idx + try_all_lowest_bit(failed);
+      }
+    }
+#endif
+    for(; idx < n; idx++)
+    {
+      if((try_all_load_status(p + idx * stride) & have_value) == 0)
+      {
+        return idx;
+      }
+    }
+    return n;
+  }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class Result> class values_view
+{
+  Result *_begin{nullptr};
+  size_t _size{0};
+
+public:
+  using value_type = typename std::remove_const_t<Result>::value_type;
+  using reference = decltype(std::declval<Result &>().assume_value());
+  using size_type = size_t;
+
+  class iterator
+  {
+    Result *_p{nullptr};
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename values_view::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::add_pointer_t<std::remove_reference_t<typename values_view::reference>>;
+    using reference = typename values_view::reference;
+
+    constexpr iterator() noexcept = default;
+    constexpr explicit iterator(Result *p) noexcept
+        : _p(p)
+    {
+    }
+    constexpr reference operator*() const noexcept { return _p->assume_value(); }
+    constexpr pointer operator->() const noexcept { return &_p->assume_value(); }
+    constexpr iterator &operator++() noexcept
+    {
+      ++_p;
+      return *this;
+    }
+    constexpr iterator operator++(int) noexcept
+    {
+      iterator ret(*this);
+      ++_p;
+      return ret;
+    }
+    constexpr bool operator==(const iterator &o) const noexcept { return _p == o._p; }
+    constexpr bool operator!=(const iterator &o) const noexcept { return _p != o._p; }
+  };
+
+  constexpr values_view() noexcept = default;
+  constexpr values_view(Result *begin, size_t size) noexcept
+      : _begin(begin)
+      , _size(size)
+  {
+  }
+
+  constexpr size_type size() const noexcept { return _size; }
+  constexpr bool empty() const noexcept { return _size == 0; }
+  //! The results being viewed, all of which have a value.
+  constexpr Result *results() const noexcept { return _begin; }
+  //! Narrow access to the value of the i-th result, there is no branch as all are known to have values.
+  constexpr reference operator[](size_type i) const noexcept { return _begin[i].assume_value(); }
+  constexpr iterator begin() const noexcept { return iterator(_begin); }
+  constexpr iterator end() const noexcept { return iterator(_begin + _size); }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+OUTCOME_TEMPLATE(class Result)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(is_basic_result<Result>::value))
+inline auto try_all(Result *first, size_t count)
+-> basic_result<values_view<Result>, typename std::remove_const_t<Result>::error_type, typename std::remove_const_t<Result>::no_value_policy_type>
+{
+  using ret_type =
+  basic_result<values_view<Result>, typename std::remove_const_t<Result>::error_type, typename std::remove_const_t<Result>::no_value_policy_type>;
+  if(count == 0)
+  {
+    return ret_type{in_place_type<values_view<Result>>, first, count};
+  }
+  const size_t idx = detail::try_all_first_without_value(detail::try_all_status_access::status(*first), sizeof(Result), count);
+  if(idx != count)
+  {
+    return ret_type{failure(first[idx].assume_error(), hooks::spare_storage(&first[idx]))};
+  }
+  return ret_type{in_place_type<values_view<Result>>, first, count};
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+OUTCOME_TEMPLATE(class Cont)
+OUTCOME_TREQUIRES(OUTCOME_TEXPR(try_all(std::declval<Cont &>().data(), static_cast<size_t>(std::declval<Cont &>().size()))))
+inline auto try_all(Cont &&c) -> decltype(try_all(c.data(), static_cast<size_t>(c.size())))
+{
+  return try_all(c.data(), static_cast<size_t>(c.size()));
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+OUTCOME_TEMPLATE(class Result, size_t N)
+OUTCOME_TREQUIRES(OUTCOME_TPRED(is_basic_result<Result>::value))
+inline auto try_all(Result (&arr)[N]) -> decltype(try_all(&arr[0], N))
+{
+  return try_all(&arr[0], N);
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
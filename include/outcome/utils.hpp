@@ -27,110 +27,556 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include "config.hpp"
 
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
 #include <exception>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 #include <system_error>
+#include <typeinfo>
 
 OUTCOME_V2_NAMESPACE_BEGIN
 
 #ifdef __cpp_exceptions
-/*! AWAITING HUGO JSON CONVERSION TOOL 
+namespace detail
+{
+  // The dynamic type of the exception within `ep` if the standard library can say without rethrowing it, otherwise null
+  inline const std::type_info *exception_ptr_type(const std::exception_ptr &ep) noexcept
+  {
+#if defined(__GLIBCXX__) && defined(__GXX_RTTI)
+    return ep.__cxa_exception_type();
+#else
+    (void) ep;
+    return nullptr;
+#endif
+  }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-inline std::error_code error_from_exception(std::exception_ptr &&ep = std::current_exception(), std::error_code not_matched = std::make_error_code(std::errc::resource_unavailable_try_again)) noexcept
+class exception_error_registry
 {
-  if(!ep)
+public:
+  //! The most mappings which can be added.
+  static constexpr size_t max_mappings = 64;
+  //! The most dynamic exception types whose mapping is remembered.
+  static constexpr size_t cache_slots = 256;
+
+private:
+  enum class match_kind : unsigned char
+  {
+    unmatched,
+    by_type,   // the code depends only on the type thrown, so may be remembered
+    by_object  // the code was read from the object thrown
+  };
+  struct mapping
   {
-    return {};
+    match_kind (*resolve)(const exception_error_registry *self, size_t idx, size_t count, const std::exception_ptr &ep, std::error_code &out);
+    std::error_code code;
+    void (*convert)();  // std::error_code (*)(const T &) if by object
+  };
+  /* Each entry is a sequence lock: the sequence is odd while the entry is being written, and
+  readers discard what they read if the sequence was odd or changed meanwhile. So an entry whose
+  generation is stale can be rewritten in place, and the cache never fills with stale entries.
+  */
+  struct cache_entry
+  {
+    std::atomic<size_t> sequence{0};
+    std::atomic<const std::type_info *> type{nullptr};
+    std::atomic<size_t> generation{0};  // the number of mappings when resolved
+    std::atomic<match_kind> kind{match_kind::unmatched};
+    std::atomic<int> value{0};
+    std::atomic<const std::error_category *> category{nullptr};
+  };
+  struct cache_snapshot
+  {
+    const std::type_info *type;
+    size_t generation;
+    match_kind kind;
+    int value;
+    const std::error_category *category;
+  };
+  static constexpr size_t _max_probes = 8;
+
+  mapping _mappings[max_mappings];
+  std::atomic<size_t> _count{0};  // mappings published
+  std::mutex _lock;               // serialises adding mappings
+  cache_entry _cache[cache_slots];
+
+  static size_t _hash(const std::type_info *type) noexcept
+  {
+    // type_info objects are unique per type within a binary, so hash their address
+    size_t h = reinterpret_cast<uintptr_t>(type);
+    return (h ^ (h >> 4) ^ (h >> 12)) & (cache_slots - 1);
   }
-  try
+
+  /* Each mapping rethrows within the try block of the mapping before it, so the most recently
+  added mapping's catch clause is innermost and is tried first. All the mappings are tried by a
+  single rethrow.
+  */
+  match_kind _resolve_from(size_t idx, size_t count, const std::exception_ptr &ep, std::error_code &out) const
   {
-    std::rethrow_exception(ep);
+    if(idx == count)
+    {
+      std::rethrow_exception(ep);
+    }
+    return _mappings[idx].resolve(this, idx, count, ep, out);
   }
-  catch(const std::invalid_argument & /*unused*/)
+  template <class T> static match_kind _resolve_by_type(const exception_error_registry *self, size_t idx, size_t count, const std::exception_ptr &ep, std::error_code &out)
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::invalid_argument);
+    try
+    {
+      return self->_resolve_from(idx + 1, count, ep, out);
+    }
+    catch(const T & /*unused*/)
+    {
+      out = self->_mappings[idx].code;
+      return match_kind::by_type;
+    }
   }
-  catch(const std::domain_error & /*unused*/)
+  template <class T> static match_kind _resolve_by_object(const exception_error_registry *self, size_t idx, size_t count, const std::exception_ptr &ep, std::error_code &out)
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::argument_out_of_domain);
+    try
+    {
+      return self->_resolve_from(idx + 1, count, ep, out);
+    }
+    catch(const T &e)
+    {
+      out = reinterpret_cast<std::error_code (*)(const T &)>(self->_mappings[idx].convert)(e);
+      return match_kind::by_object;
+    }
   }
-  catch(const std::length_error & /*unused*/)
+  // The mappings added, falling back onto those for the standard library exceptions
+  match_kind _resolve(size_t count, const std::exception_ptr &ep, std::error_code &out) const noexcept
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::argument_list_too_long);
+    try
+    {
+      return _resolve_from(0, count, ep, out);
+    }
+    catch(const std::invalid_argument & /*unused*/)
+    {
+      out = std::make_error_code(std::errc::invalid_argument);
+    }
+    catch(const std::domain_error & /*unused*/)
+    {
+      out = std::make_error_code(std::errc::argument_out_of_domain);
+    }
+    catch(const std::length_error & /*unused*/)
+    {
+      out = std::make_error_code(std::errc::argument_list_too_long);
+    }
+    catch(const std::out_of_range & /*unused*/)
+    {
+      out = std::make_error_code(std::errc::result_out_of_range);
+    }
+    catch(const std::logic_error & /*unused*/) /* base class for this group */
+    {
+      out = std::make_error_code(std::errc::invalid_argument);
+    }
+    catch(const std::system_error &e) /* also catches ios::failure */
+    {
+      out = e.code();
+      return match_kind::by_object;
+    }
+    catch(const std::overflow_error & /*unused*/)
+    {
+      out = std::make_error_code(std::errc::value_too_large);
+    }
+    catch(const std::range_error & /*unused*/)
+    {
+      out = std::make_error_code(std::errc::result_out_of_range);
+    }
+    catch(const std::runtime_error & /*unused*/) /* base class for this group */
+    {
+      out = std::make_error_code(std::errc::resource_unavailable_try_again);
+    }
+    catch(const std::bad_alloc & /*unused*/)
+    {
+      out = std::make_error_code(std::errc::not_enough_memory);
+    }
+    catch(...)
+    {
+      return match_kind::unmatched;
+    }
+    return match_kind::by_type;
   }
-  catch(const std::out_of_range & /*unused*/)
+
+  // Returns false if the entry was being written
+  static bool _read(const cache_entry &e, size_t &sequence, cache_snapshot &out) noexcept
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::result_out_of_range);
+    sequence = e.sequence.load(std::memory_order_acquire);
+    if((sequence & 1) != 0)
+    {
+      return false;
+    }
+    out.type = e.type.load(std::memory_order_relaxed);
+    out.generation = e.generation.load(std::memory_order_relaxed);
+    out.kind = e.kind.load(std::memory_order_relaxed);
+    out.value = e.value.load(std::memory_order_relaxed);
+    out.category = e.category.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return e.sequence.load(std::memory_order_relaxed) == sequence;
   }
-  catch(const std::logic_error & /*unused*/) /* base class for this group */
+  bool _find(const std::type_info *type, size_t generation, cache_snapshot &out) const noexcept
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::invalid_argument);
+    for(size_t n = 0, idx = _hash(type); n < _max_probes; n++, idx = (idx + 1) & (cache_slots - 1))
+    {
+      size_t sequence;
+      if(!_read(_cache[idx], sequence, out))
+      {
+        continue;
+      }
+      if(out.type == nullptr)
+      {
+        return false;
+      }
+      if(out.type == type && out.generation == generation)
+      {
+        return true;
+      }
+    }
+    return false;
   }
-  catch(const std::system_error &e) /* also catches ios::failure */
+  // Takes the first slot probed which is empty, remembers this type, or was resolved by an earlier generation
+  void _remember(const std::type_info *type, size_t generation, match_kind kind, std::error_code code) noexcept
   {
-    ep = std::exception_ptr();
-    return e.code();
+    for(size_t n = 0, idx = _hash(type); n < _max_probes; n++, idx = (idx + 1) & (cache_slots - 1))
+    {
+      cache_entry &e = _cache[idx];
+      size_t sequence;
+      cache_snapshot s;
+      if(!_read(e, sequence, s))
+      {
+        continue;
+      }
+      if(s.type != nullptr && s.generation >= generation)
+      {
+        if(s.type == type)
+        {
+          return;
+        }
+        continue;
+      }
+      if(!e.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+      {
+        continue;
+      }
+      std::atomic_thread_fence(std::memory_order_release);
+      e.type.store(type, std::memory_order_relaxed);
+      e.generation.store(generation, std::memory_order_relaxed);
+      e.kind.store(kind, std::memory_order_relaxed);
+      e.value.store(code.value(), std::memory_order_relaxed);
+      e.category.store(&code.category(), std::memory_order_relaxed);
+      e.sequence.store(sequence + 2, std::memory_order_release);
+      return;
+    }
   }
-  catch(const std::overflow_error & /*unused*/)
+
+public:
+  exception_error_registry() = default;
+  exception_error_registry(const exception_error_registry &) = delete;
+  exception_error_registry &operator=(const exception_error_registry &) = delete;
+
+  //! Maps exceptions of type `T`, or derived from it, to `ec`. Returns false if there is no room for another mapping.
+  template <class T> bool add(std::error_code ec)
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::value_too_large);
+    std::lock_guard<std::mutex> g(_lock);
+    const size_t count = _count.load(std::memory_order_relaxed);
+    if(count == max_mappings)
+    {
+      return false;
+    }
+    _mappings[count] = {&_resolve_by_type<T>, ec, nullptr};
+    _count.store(count + 1, std::memory_order_release);
+    return true;
   }
-  catch(const std::range_error & /*unused*/)
+  /*! Maps exceptions of type `T`, or derived from it, to the code returned by `convert`. As the
+  code depends on the object thrown, such exceptions are always rethrown. Returns false if there
+  is no room for another mapping.
+  */
+  template <class T> bool add(std::error_code (*convert)(const T &))
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::result_out_of_range);
+    std::lock_guard<std::mutex> g(_lock);
+    const size_t count = _count.load(std::memory_order_relaxed);
+    if(count == max_mappings)
+    {
+      return false;
+    }
+    _mappings[count] = {&_resolve_by_object<T>, {}, reinterpret_cast<void (*)()>(convert)};
+    _count.store(count + 1, std::memory_order_release);
+    return true;
   }
-  catch(const std::runtime_error & /*unused*/) /* base class for this group */
+  //! The number of mappings added.
+  size_t size() const noexcept { return _count.load(std::memory_order_acquire); }
+
+  /*! Returns the code for the exception within `ep`, resetting `ep` if matched, else returns
+  `not_matched`. Mappings added later take precedence over those added earlier, which take
+  precedence over those for the standard library exceptions.
+  */
+  std::error_code lookup(std::exception_ptr &ep, std::error_code not_matched) noexcept
   {
+    if(!ep)
+    {
+      return {};
+    }
+    const size_t generation = _count.load(std::memory_order_acquire);
+    const std::type_info *type = detail::exception_ptr_type(ep);
+    cache_snapshot cached;
+    if(type != nullptr && _find(type, generation, cached))
+    {
+      if(cached.kind == match_kind::unmatched)
+      {
+        return not_matched;
+      }
+      ep = std::exception_ptr();
+      return {cached.value, *cached.category};
+    }
+    std::error_code code;
+    const match_kind kind = _resolve(generation, ep, code);
+    if(type != nullptr && kind != match_kind::by_object)
+    {
+      _remember(type, generation, kind, code);
+    }
+    if(kind == match_kind::unmatched)
+    {
+      return not_matched;
+    }
     ep = std::exception_ptr();
-    return std::make_error_code(std::errc::resource_unavailable_try_again);
+    return code;
+  }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline exception_error_registry &exception_error_mappings() noexcept
+{
+  static exception_error_registry v;
+  return v;
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL 
+SIGNATURE NOT RECOGNISED
+*/
+inline std::error_code error_from_exception(std::exception_ptr &&ep = std::current_exception(), std::error_code not_matched = std::make_error_code(std::errc::resource_unavailable_try_again)) noexcept
+{
+  return exception_error_mappings().lookup(ep, not_matched);
+}
+
+namespace detail
+{
+  using std_exception_thrower = void (*)(const std::error_code &ec, const std::string &msg);
+
+  constexpr inline const char *static_exception_message(const std::invalid_argument * /*unused*/) noexcept { return "invalid argument"; }
+  constexpr inline const char *static_exception_message(const std::domain_error * /*unused*/) noexcept { return "domain error"; }
+  constexpr inline const char *static_exception_message(const std::length_error * /*unused*/) noexcept { return "length error"; }
+  constexpr inline const char *static_exception_message(const std::out_of_range * /*unused*/) noexcept { return "out of range"; }
+  constexpr inline const char *static_exception_message(const std::overflow_error * /*unused*/) noexcept { return "overflow error"; }
+
+  /* Without a message, throws a copy of an exception constructed on first use. As the copy
+  constructors of the standard exceptions are noexcept, the copy shares the message of the
+  original rather than allocating its own.
+  */
+  template <class E> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD inline void throw_std_exception(const std::error_code & /*unused*/, const std::string &msg)
+  {
+    if(!msg.empty())
+    {
+      throw E(msg);
+    }
+    static const E prototype(static_exception_message(static_cast<const E *>(nullptr)));
+    throw prototype;
   }
-  catch(const std::bad_alloc & /*unused*/)
+  OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD inline void throw_bad_alloc(const std::error_code & /*unused*/, const std::string & /*unused*/) { throw std::bad_alloc(); }
+  OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD inline void throw_system_error(const std::error_code &ec, const std::string &msg)
   {
-    ep = std::exception_ptr();
-    return std::make_error_code(std::errc::not_enough_memory);
+    if(!msg.empty())
+    {
+      throw std::system_error(ec, msg);
+    }
+    throw std::system_error(ec);
   }
-  catch(...)
+  // As throw_std_exception(), throws a copy of a system_error constructed on first use if there is no message
+  template <int Value> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD inline void throw_errno_system_error(const std::error_code &ec, const std::string &msg)
   {
+    if(!msg.empty())
+    {
+      throw std::system_error(ec, msg);
+    }
+    if(ec.category() == std::generic_category())
+    {
+      static const std::system_error prototype(std::error_code(Value, std::generic_category()));
+      throw prototype;
+    }
+    static const std::system_error prototype(std::error_code(Value, std::system_category()));
+    throw prototype;
   }
-  return not_matched;
-}
+
+  // Visits the thrower for each errno value which has a nearer standard exception than std::system_error
+  struct std_exception_throwers
+  {
+    template <class F> static constexpr F visit(F f) noexcept
+    {
+      f(EINVAL, &throw_std_exception<std::invalid_argument>);
+      f(EDOM, &throw_std_exception<std::domain_error>);
+      f(E2BIG, &throw_std_exception<std::length_error>);
+      f(ERANGE, &throw_std_exception<std::out_of_range>);
+      f(EOVERFLOW, &throw_std_exception<std::overflow_error>);
+      f(ENOMEM, &throw_bad_alloc);
+      return f;
+    }
+  };
+  // Visits a thrower of std::system_error for each errno value of std::errc
+  struct system_error_throwers
+  {
+    template <class F> static constexpr F visit(F f) noexcept
+    {
+      f(EACCES, &throw_errno_system_error<EACCES>);
+      f(EADDRINUSE, &throw_errno_system_error<EADDRINUSE>);
+      f(EADDRNOTAVAIL, &throw_errno_system_error<EADDRNOTAVAIL>);
+      f(EAFNOSUPPORT, &throw_errno_system_error<EAFNOSUPPORT>);
+      f(EAGAIN, &throw_errno_system_error<EAGAIN>);
+      f(EALREADY, &throw_errno_system_error<EALREADY>);
+      f(EBADF, &throw_errno_system_error<EBADF>);
+      f(EBADMSG, &throw_errno_system_error<EBADMSG>);
+      f(EBUSY, &throw_errno_system_error<EBUSY>);
+      f(ECANCELED, &throw_errno_system_error<ECANCELED>);
+      f(ECHILD, &throw_errno_system_error<ECHILD>);
+      f(ECONNABORTED, &throw_errno_system_error<ECONNABORTED>);
+      f(ECONNREFUSED, &throw_errno_system_error<ECONNREFUSED>);
+      f(ECONNRESET, &throw_errno_system_error<ECONNRESET>);
+      f(EDEADLK, &throw_errno_system_error<EDEADLK>);
+      f(EDESTADDRREQ, &throw_errno_system_error<EDESTADDRREQ>);
+      f(EEXIST, &throw_errno_system_error<EEXIST>);
+      f(EFAULT, &throw_errno_system_error<EFAULT>);
+      f(EFBIG, &throw_errno_system_error<EFBIG>);
+      f(EHOSTUNREACH, &throw_errno_system_error<EHOSTUNREACH>);
+      f(EIDRM, &throw_errno_system_error<EIDRM>);
+      f(EILSEQ, &throw_errno_system_error<EILSEQ>);
+      f(EINPROGRESS, &throw_errno_system_error<EINPROGRESS>);
+      f(EINTR, &throw_errno_system_error<EINTR>);
+      f(EIO, &throw_errno_system_error<EIO>);
+      f(EISCONN, &throw_errno_system_error<EISCONN>);
+      f(EISDIR, &throw_errno_system_error<EISDIR>);
+      f(ELOOP, &throw_errno_system_error<ELOOP>);
+      f(EMFILE, &throw_errno_system_error<EMFILE>);
+      f(EMLINK, &throw_errno_system_error<EMLINK>);
+      f(EMSGSIZE, &throw_errno_system_error<EMSGSIZE>);
+      f(ENAMETOOLONG, &throw_errno_system_error<ENAMETOOLONG>);
+      f(ENETDOWN, &throw_errno_system_error<ENETDOWN>);
+      f(ENETRESET, &throw_errno_system_error<ENETRESET>);
+      f(ENETUNREACH, &throw_errno_system_error<ENETUNREACH>);
+      f(ENFILE, &throw_errno_system_error<ENFILE>);
+      f(ENOBUFS, &throw_errno_system_error<ENOBUFS>);
+#ifdef ENODATA
+      f(ENODATA, &throw_errno_system_error<ENODATA>);
+#endif
+      f(ENODEV, &throw_errno_system_error<ENODEV>);
+      f(ENOENT, &throw_errno_system_error<ENOENT>);
+      f(ENOEXEC, &throw_errno_system_error<ENOEXEC>);
+      f(ENOLCK, &throw_errno_system_error<ENOLCK>);
+      f(ENOLINK, &throw_errno_system_error<ENOLINK>);
+      f(ENOMSG, &throw_errno_system_error<ENOMSG>);
+      f(ENOPROTOOPT, &throw_errno_system_error<ENOPROTOOPT>);
+      f(ENOSPC, &throw_errno_system_error<ENOSPC>);
+#ifdef ENOSR
+      f(ENOSR, &throw_errno_system_error<ENOSR>);
+#endif
+#ifdef ENOSTR
+      f(ENOSTR, &throw_errno_system_error<ENOSTR>);
+#endif
+      f(ENOSYS, &throw_errno_system_error<ENOSYS>);
+      f(ENOTCONN, &throw_errno_system_error<ENOTCONN>);
+      f(ENOTDIR, &throw_errno_system_error<ENOTDIR>);
+      f(ENOTEMPTY, &throw_errno_system_error<ENOTEMPTY>);
+      f(ENOTRECOVERABLE, &throw_errno_system_error<ENOTRECOVERABLE>);
+      f(ENOTSOCK, &throw_errno_system_error<ENOTSOCK>);
+      f(ENOTSUP, &throw_errno_system_error<ENOTSUP>);
+      f(ENOTTY, &throw_errno_system_error<ENOTTY>);
+      f(ENXIO, &throw_errno_system_error<ENXIO>);
+      f(EOPNOTSUPP, &throw_errno_system_error<EOPNOTSUPP>);
+      f(EOWNERDEAD, &throw_errno_system_error<EOWNERDEAD>);
+      f(EPERM, &throw_errno_system_error<EPERM>);
+      f(EPIPE, &throw_errno_system_error<EPIPE>);
+      f(EPROTO, &throw_errno_system_error<EPROTO>);
+      f(EPROTONOSUPPORT, &throw_errno_system_error<EPROTONOSUPPORT>);
+      f(EPROTOTYPE, &throw_errno_system_error<EPROTOTYPE>);
+      f(EROFS, &throw_errno_system_error<EROFS>);
+      f(ESPIPE, &throw_errno_system_error<ESPIPE>);
+      f(ESRCH, &throw_errno_system_error<ESRCH>);
+#ifdef ETIME
+      f(ETIME, &throw_errno_system_error<ETIME>);
+#endif
+      f(ETIMEDOUT, &throw_errno_system_error<ETIMEDOUT>);
+      f(ETXTBSY, &throw_errno_system_error<ETXTBSY>);
+      f(EWOULDBLOCK, &throw_errno_system_error<EWOULDBLOCK>);
+      f(EXDEV, &throw_errno_system_error<EXDEV>);
+      return f;
+    }
+  };
+  struct std_exception_thrower_max
+  {
+    int value{0};
+    constexpr void operator()(int v, std_exception_thrower /*unused*/) noexcept { value = (v > value) ? v : value; }
+  };
+  struct std_exception_thrower_fill
+  {
+    std_exception_thrower *throwers;
+    // Errno values which share a number also share a thrower, so none is lost
+    constexpr void operator()(int v, std_exception_thrower thrower) noexcept { throwers[v] = thrower; }
+  };
+
+  // A thrower for each errno value visited by Throwers, indexed by value, null for those not visited
+  template <class Throwers> struct errno_thrower_table
+  {
+    static constexpr int size = Throwers::visit(std_exception_thrower_max{}).value + 1;
+    std_exception_thrower throwers[size]{};
+
+    constexpr errno_thrower_table() noexcept { Throwers::visit(std_exception_thrower_fill{throwers}); }
+
+    // The thrower for `ec`, or null if it has none or is not of a category of errno values
+    std_exception_thrower find(const std::error_code &ec) const noexcept
+    {
+      if(!ec || (ec.category() != std::generic_category()
+#ifndef _WIN32
+                 && ec.category() != std::system_category()
+#endif
+                 ))
+      {
+        return nullptr;
+      }
+      const int value = ec.value();
+      return (value > 0 && value < size) ? throwers[value] : nullptr;
+    }
+  };
+}  // namespace detail
 
 /*! AWAITING HUGO JSON CONVERSION TOOL 
 SIGNATURE NOT RECOGNISED
 */
 inline void try_throw_std_exception_from_error(std::error_code ec, const std::string &msg = std::string{})
 {
-  if(!ec || (ec.category() != std::generic_category()
-#ifndef _WIN32
-             && ec.category() != std::system_category()
-#endif
-             ))
+  static constexpr detail::errno_thrower_table<detail::std_exception_throwers> table;
+  if(auto thrower = table.find(ec))
   {
-    return;
+    thrower(ec, msg);
   }
-  switch(ec.value())
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL 
+SIGNATURE NOT RECOGNISED
+*/
+OUTCOME_NORETURN inline void throw_std_exception_from_error(std::error_code ec, const std::string &msg = std::string{})
+{
+  try_throw_std_exception_from_error(ec, msg);
+  static constexpr detail::errno_thrower_table<detail::system_error_throwers> table;
+  if(auto thrower = table.find(ec))
   {
-  case EINVAL:
-    throw msg.empty() ? std::invalid_argument("invalid argument") : std::invalid_argument(msg);
-  case EDOM:
-    throw msg.empty() ? std::domain_error("domain error") : std::domain_error(msg);
-  case E2BIG:
-    throw msg.empty() ? std::length_error("length error") : std::length_error(msg);
-  case ERANGE:
-    throw msg.empty() ? std::out_of_range("out of range") : std::out_of_range(msg);
-  case EOVERFLOW:
-    throw msg.empty() ? std::overflow_error("overflow error") : std::overflow_error(msg);
-  case ENOMEM:
-    throw std::bad_alloc();
+    thrower(ec, msg);
   }
+  detail::throw_system_error(ec, msg);
 }
 #endif
 
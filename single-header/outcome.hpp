@@ -841,6 +841,19 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef OUTCOME_NODISCARD
 #define OUTCOME_NODISCARD QUICKCPPLIB_NODISCARD
 #endif
+#ifndef OUTCOME_NOINLINE
+#define OUTCOME_NOINLINE QUICKCPPLIB_NOINLINE
+#endif
+#ifndef OUTCOME_NORETURN
+#define OUTCOME_NORETURN QUICKCPPLIB_NORETURN
+#endif
+#ifndef OUTCOME_COLD
+#if defined(__GNUC__) || defined(__clang__)
+#define OUTCOME_COLD __attribute__((cold))
+#else
+#define OUTCOME_COLD
+#endif
+#endif
 #ifndef OUTCOME_THREAD_LOCAL
 #define OUTCOME_THREAD_LOCAL QUICKCPPLIB_THREAD_LOCAL
 #endif
@@ -4378,6 +4391,12 @@ SIGNATURE NOT RECOGNISED
   {
     template <class... Args> static constexpr void _silence_unused(Args &&... /*unused*/) noexcept {}
   protected:
+    // Policies which throw do so from out of line, cold, noreturn _throw_no_*() members, so the inlined
+    // wide checks in the observers reduce to a compare and a branch. Those throwing an exception type
+    // constructed from a message share these, the others define their own _throw_no_value().
+    template <class Exception> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_value() { OUTCOME_THROW_EXCEPTION(Exception("no value")); } // NOLINT
+    template <class Exception> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_error() { OUTCOME_THROW_EXCEPTION(Exception("no error")); } // NOLINT
+    template <class Exception> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_exception() { OUTCOME_THROW_EXCEPTION(Exception("no exception")); } // NOLINT
     template <class Impl> static constexpr void _make_ub(Impl &&self) noexcept { return detail::make_ub(static_cast<Impl &&>(self)); }
     template <class Impl> static constexpr bool _has_value(Impl &&self) noexcept { return self._state._status.have_value(); }
     template <class Impl> static constexpr bool _has_error(Impl &&self) noexcept { return self._state._status.have_error(); }
@@ -5577,20 +5596,24 @@ SIGNATURE NOT RECOGNISED
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        if(base::_has_error(std::forward<Impl>(self)))
-        {
-          // ADL discovered
-          outcome_throw_as_system_error_with_payload(base::_error(std::forward<Impl>(self)));
-        }
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no value")); // NOLINT
+        _throw_no_value(std::forward<Impl>(self));
       }
     }
     template <class Impl> static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no error")); // NOLINT
+        _throw_no_error<bad_result_access>();
+      }
+    }
+    template <class Impl> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_value(Impl &&self)
+    {
+      if(base::_has_error(std::forward<Impl>(self)))
+      {
+        // ADL discovered
+        outcome_throw_as_system_error_with_payload(base::_error(std::forward<Impl>(self)));
       }
+      OUTCOME_THROW_EXCEPTION(bad_result_access("no value")); // NOLINT
     }
   };
 } // namespace policy
@@ -5634,21 +5657,25 @@ SIGNATURE NOT RECOGNISED
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        if(base::_has_error(std::forward<Impl>(self)))
-        {
-          // ADL
-          rethrow_exception(policy::exception_ptr(base::_error(std::forward<Impl>(self))));
-        }
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no value")); // NOLINT
+        _throw_no_value(std::forward<Impl>(self));
       }
     }
     template <class Impl> static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no error")); // NOLINT
+        _throw_no_error<bad_result_access>();
       }
     }
+    template <class Impl> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_value(Impl &&self)
+    {
+      if(base::_has_error(std::forward<Impl>(self)))
+      {
+        // ADL
+        rethrow_exception(policy::exception_ptr(base::_error(std::forward<Impl>(self))));
+      }
+      OUTCOME_THROW_EXCEPTION(bad_result_access("no value")); // NOLINT
+    }
   };
 } // namespace policy
 OUTCOME_V2_NAMESPACE_END
@@ -5690,21 +5717,21 @@ type definition  throw_bad_result_access. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value")); // NOLINT
+        _throw_no_value<bad_outcome_access>();
       }
     }
     template <class Impl> static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no error")); // NOLINT
+        _throw_no_error<bad_outcome_access>();
       }
     }
     template <class Impl> static constexpr void wide_exception_check(Impl &&self)
     {
       if(!base::_has_exception(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no exception")); // NOLINT
+        _throw_no_exception<bad_outcome_access>();
       }
     }
   };
@@ -5714,20 +5741,24 @@ type definition  throw_bad_result_access. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        if(base::_has_error(std::forward<Impl>(self)))
-        {
-          OUTCOME_THROW_EXCEPTION(bad_result_access_with<EC>(base::_error(std::forward<Impl>(self))));
-        }
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no value")); // NOLINT
+        _throw_no_value(std::forward<Impl>(self));
       }
     }
     template <class Impl> static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_result_access("no error")); // NOLINT
+        _throw_no_error<bad_result_access>();
       }
     }
+    template <class Impl> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_value(Impl &&self)
+    {
+      if(base::_has_error(std::forward<Impl>(self)))
+      {
+        OUTCOME_THROW_EXCEPTION(bad_result_access_with<EC>(base::_error(std::forward<Impl>(self))));
+      }
+      OUTCOME_THROW_EXCEPTION(bad_result_access("no value")); // NOLINT
+    }
   };
 } // namespace policy
 OUTCOME_V2_NAMESPACE_END
@@ -7166,31 +7197,35 @@ type definition  error_code_throw_as_system_error. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        if(base::_has_exception(std::forward<Impl>(self)))
-        {
-          detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, error_code_throw_as_system_error>(std::forward<Impl>(self))}; // NOLINT
-        }
-        if(base::_has_error(std::forward<Impl>(self)))
-        {
-          // ADL discovered
-          outcome_throw_as_system_error_with_payload(base::_error(std::forward<Impl>(self)));
-        }
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value")); // NOLINT
+        _throw_no_value(std::forward<Impl>(self));
       }
     }
     template <class Impl> static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no error")); // NOLINT
+        _throw_no_error<bad_outcome_access>();
       }
     }
     template <class Impl> static constexpr void wide_exception_check(Impl &&self)
     {
       if(!base::_has_exception(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no exception")); // NOLINT
+        _throw_no_exception<bad_outcome_access>();
+      }
+    }
+    template <class Impl> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_value(Impl &&self)
+    {
+      if(base::_has_exception(std::forward<Impl>(self)))
+      {
+        detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, error_code_throw_as_system_error>(std::forward<Impl>(self))}; // NOLINT
+      }
+      if(base::_has_error(std::forward<Impl>(self)))
+      {
+        // ADL discovered
+        outcome_throw_as_system_error_with_payload(base::_error(std::forward<Impl>(self)));
       }
+      OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value")); // NOLINT
     }
   };
 } // namespace policy
@@ -7233,30 +7268,34 @@ type definition  exception_ptr_rethrow. Potential doc page: NOT FOUND
     {
       if(!base::_has_value(std::forward<Impl>(self)))
       {
-        if(base::_has_exception(std::forward<Impl>(self)))
-        {
-          detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, exception_ptr_rethrow>(std::forward<Impl>(self))};
-        }
-        if(base::_has_error(std::forward<Impl>(self)))
-        {
-          detail::_rethrow_exception<trait::is_exception_ptr_available<EC>::value>{base::_error(std::forward<Impl>(self))};
-        }
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value")); // NOLINT
+        _throw_no_value(std::forward<Impl>(self));
       }
     }
     template <class Impl> static constexpr void wide_error_check(Impl &&self)
     {
       if(!base::_has_error(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no error")); // NOLINT
+        _throw_no_error<bad_outcome_access>();
       }
     }
     template <class Impl> static constexpr void wide_exception_check(Impl &&self)
     {
       if(!base::_has_exception(std::forward<Impl>(self)))
       {
-        OUTCOME_THROW_EXCEPTION(bad_outcome_access("no exception")); // NOLINT
+        _throw_no_exception<bad_outcome_access>();
+      }
+    }
+    template <class Impl> OUTCOME_NORETURN OUTCOME_NOINLINE OUTCOME_COLD static void _throw_no_value(Impl &&self)
+    {
+      if(base::_has_exception(std::forward<Impl>(self)))
+      {
+        detail::_rethrow_exception<trait::is_exception_ptr_available<E>::value>{base::_exception<T, EC, E, exception_ptr_rethrow>(std::forward<Impl>(self))};
+      }
+      if(base::_has_error(std::forward<Impl>(self)))
+      {
+        detail::_rethrow_exception<trait::is_exception_ptr_available<EC>::value>{base::_error(std::forward<Impl>(self))};
       }
+      OUTCOME_THROW_EXCEPTION(bad_outcome_access("no value")); // NOLINT
     }
   };
 } // namespace policy
@@ -7752,7 +7791,7 @@ SIGNATURE NOT RECOGNISED
 */
 #define OUTCOME_CO_TRYV2_FAILURE_LIKELY(s, ...) OUTCOME_TRYV3_FAILURE_LIKELY(OUTCOME_TRY_UNIQUE_NAME, co_return, s(,), __VA_ARGS__)
 #if defined(__GNUC__) || defined(__clang__)
-#define OUTCOME_TRYX2(unique, retstmt, ...) ({ OUTCOME_TRYV2_SUCCESS_LIKELY(unique, retstmt, deduce, __VA_ARGS__); ::OUTCOME_V2_NAMESPACE::try_operation_extract_value(static_cast<decltype(unique) &&>(unique)); })
+#define OUTCOME_TRYX2(unique, retstmt, ...) __extension__({ OUTCOME_TRYV2_SUCCESS_LIKELY(unique, retstmt, deduce, __VA_ARGS__); ::OUTCOME_V2_NAMESPACE::try_operation_extract_value(static_cast<decltype(unique) &&>(unique)); })
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
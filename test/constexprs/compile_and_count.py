@@ -30,6 +30,37 @@ _compile_info_ = \
                            + "-D_UNICODE=1 -DUNICODE=1 {} -o {} -fms-compatibility-version=19"), _mk_o("cpp", "out"))
     }
 
+# Where quickcpplib is found, in the same order as cmake/QuickCppLibBootstrap.cmake looks for it:
+# CTEST_QUICKCPPLIB_CLONE_DIR if set, a sibling checkout if .quickcpplib_use_siblings is above this
+# repo, else the clone inside this repo.
+def _quickcpplib_include() -> str:
+    root = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."))
+    candidates = []
+    if os.environ.get("CTEST_QUICKCPPLIB_CLONE_DIR"):
+        candidates.append(os.path.join(os.environ["CTEST_QUICKCPPLIB_CLONE_DIR"], "repo", "include"))
+    if os.path.isdir(os.path.join(root, "..", ".quickcpplib_use_siblings")):
+        candidates.append(os.path.join(root, "..", "quickcpplib", "include"))
+    candidates.append(os.path.join(root, "quickcpplib", "repo", "include"))
+    for candidate in candidates:
+        if os.path.isfile(os.path.join(candidate, "quickcpplib", "config.hpp")):
+            return os.path.normpath(candidate)
+    print("[-] quickcpplib not found in any of " + ", ".join(candidates) + ", set CTEST_QUICKCPPLIB_CLONE_DIR "
+          + "to the directory cmake cloned it into", file=sys.stderr)
+    sys.exit(1)
+
+# Tests needing a newer language standard than the rest, such as for Coroutines. These use the
+# headers in include rather than the single header, so also need quickcpplib. Each entry is the
+# compiler to use instead of the default, or None, and the extra flags. GCC 10 is the first with
+# Coroutines, and clang 9 has only the Coroutines TS, with libc++'s <experimental/coroutine>.
+def _coroutine_flags():
+    inc = _quickcpplib_include()
+    return { 'gcc' : ("g++-10", "-std=c++2a -fcoroutines -I" + inc), 'clang' : (None, "-std=c++2a -fcoroutines-ts -stdlib=libc++ -I" + inc)
+           , 'msvc' : (None, "/std:c++latest /I" + inc), 'msvc_clang' : (None, "-std=c++20 -I" + inc) }
+
+_extra_flags_ = \
+    { "min_lazy_await_value" : _coroutine_flags
+    }
+
 _disassemble_info_ = \
     { "gcc"        : (_mk_f("objdump -C -d {} > {}"), _mk_o("out", "gcc.S"))
     , "clang"      : (_mk_f("objdump -C -d {} > {}"), _mk_o("out", "clang.S"))
@@ -55,6 +86,10 @@ _function_ = \
 limits = {
 "min_result_construct_value_move_destruct"     : { 'gcc' :  5, 'clang' :  5, 'msvc' :  5 },
 "min_result_next"                              : { 'gcc' :  5, 'clang' :  5, 'msvc' :  5 },
+"min_result_value_throw"                       : { 'gcc' :  6, 'clang' :  6, 'msvc' :  6 },
+"min_outcome_value_throw"                      : { 'gcc' :  6, 'clang' :  6, 'msvc' :  6 },
+"min_result_tryx"                              : { 'gcc' : 22, 'clang' : 22, 'msvc' : 30 },
+"min_lazy_await_value"                         : { 'gcc' :  3, 'clang' :  3, 'msvc' :  5 },
 }
 
 
@@ -73,8 +108,14 @@ def compile(src_file : str, compiler : str) -> str:
         file=sys.stderr)
 
     command, output = _compile_info_[compiler]
+    extra = _extra_flags_.get(src_file.replace(".cpp", ""))
+    if extra is not None:
+        extra = extra().get(compiler)
+    cmdline = command(src_file if extra is None else extra[1] + " " + src_file, output(src_file))
+    if extra is not None and extra[0] is not None:
+        cmdline = extra[0] + cmdline[cmdline.index(" "):]
     try:
-        subprocess.check_output(command(src_file, output(src_file)), 
+        subprocess.check_output(cmdline, 
             stderr=subprocess.STDOUT, shell=True)
     except subprocess.CalledProcessError as e:
         print("[-] Error while compiling: " + e.output.decode('utf-8'), 
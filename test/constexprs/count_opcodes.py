@@ -138,6 +138,17 @@ def parse(input_file : str, file_type : str) -> dict:
     return functions
 
 
+# GCC moves the unlikely blocks of a function into a separate "[clone .cold]"
+# partition. Those are part of the function, so they get counted with it.
+def merge_cold_partitions(functions : dict) -> dict:
+    merged = {}
+    for name, ops in functions.items():
+        if name.endswith(' [clone .cold]') and name[:-len(' [clone .cold]')] in functions:
+            continue
+        merged[name] = ops + functions.get(name + ' [clone .cold]', [])
+    return merged
+
+
 def find_opcodes(name : str, functions : dict, file_type : str) -> tuple:
     is_match = _is_our_function_[file_type](name)
     all_matches = list(filter(lambda t: is_match(t[0]), functions.items()))
@@ -194,6 +205,7 @@ def count_opcodes(output_file_name : str, input_file : str, func : str):
     # Read all the functions
     with open(input_file, "rt") as ih:
         functions = parse(ih, file_type)
+    functions = merge_cold_partitions(functions)
         
     # Find the one we're interested in
     name, opcodes = find_opcodes(func, functions, file_type)
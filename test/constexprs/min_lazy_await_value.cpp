@@ -0,0 +1,76 @@
+/* Canned codegen quality test sequences
+(C) 2017-2019 Niall Douglas <http://www.nedproductions.biz/> (9 commits)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/coroutine_support.hpp"
+#include "../../include/outcome.hpp"
+
+using namespace OUTCOME_V2_NAMESPACE;
+
+#ifdef OUTCOME_FOUND_COROUTINE_HEADER
+// Resuming from awaiting a non-atomic lazy should only move the result out of the promise,
+// with no check that the result was set and no call to terminate
+extern QUICKCPPLIB_NOINLINE int test1(awaitables::lazy<result<int>> &a)
+{
+  return a.await_resume().assume_value();
+}
+extern QUICKCPPLIB_NOINLINE void test2()
+{
+}
+
+inline awaitables::lazy<result<int>> five()
+{
+  co_return 5;
+}
+
+int main(void)
+{
+  int ret = 0;
+  auto a = five();
+#if OUTCOME_HAVE_NOOP_COROUTINE
+  a.await_suspend({}).resume();
+#else
+  a.await_suspend({});
+#endif
+  if(5 != test1(a))
+    ret = 1;
+  test2();
+  return ret;
+}
+#else
+extern QUICKCPPLIB_NOINLINE int test1()
+{
+  return 5;
+}
+extern QUICKCPPLIB_NOINLINE void test2()
+{
+}
+
+int main(void)
+{
+  int ret = 0;
+  if(5 != test1())
+    ret = 1;
+  test2();
+  return ret;
+}
+#endif
@@ -0,0 +1,53 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#if defined(__GNUC__) || defined(__clang__)
+// OUTCOME_TRYX must remain usable by strictly conforming builds
+#pragma GCC diagnostic error "-Wpedantic"
+#endif
+
+#include "../../single-header/outcome.hpp"
+
+using namespace OUTCOME_V2_NAMESPACE;
+
+// Should generate the same code as OUTCOME_TRY(auto v, m1); return v + 1;
+extern QUICKCPPLIB_NOINLINE result<int> test1(const result<int> &m1)
+{
+#ifdef OUTCOME_TRYX
+  return OUTCOME_TRYX(m1) + 1;
+#else
+  OUTCOME_TRY(auto v, m1);
+  return v + 1;
+#endif
+}
+extern QUICKCPPLIB_NOINLINE void test2()
+{
+}
+
+int main(void)
+{
+  int ret=0;
+  if(6!=test1(result<int>(5)).value()) ret=1;
+  test2();
+  return ret;
+}
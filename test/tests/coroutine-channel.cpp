@@ -0,0 +1,199 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/coroutine_channel.hpp"
+#include "../../include/outcome/coroutine_executor.hpp"
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/try.hpp"
+
+#if OUTCOME_FOUND_COROUTINE_HEADER
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace channel_test
+{
+  namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+  template <class T> using lazy = awaitables::lazy<T>;
+  template <class T> using atomic_lazy = awaitables::atomic_lazy<T>;
+  template <class T, class E = std::error_code> using result = OUTCOME_V2_NAMESPACE::result<T, E>;
+  using channel = awaitables::channel<result<int>>;
+
+  // Sends first to first + count - 1, failing the send of fail_at instead, then optionally closes
+  inline atomic_lazy<result<void>> producer(channel *ch, int first, int count, int fail_at = -1, bool close = false)
+  {
+    for(int n = first; n < first + count; n++)
+    {
+      result<int> r = (n == fail_at) ? result<int>(std::errc::io_error) : result<int>(n);
+      OUTCOME_CO_TRY(co_await ch->send(std::move(r)));
+    }
+    if(close)
+    {
+      ch->close();
+    }
+    co_return OUTCOME_V2_NAMESPACE::success();
+  }
+  // Receives until the channel closes, summing the values and counting the failures sent
+  inline atomic_lazy<result<long long>> consumer(channel *ch, int *failures = nullptr)
+  {
+    long long sum = 0;
+    for(;;)
+    {
+      auto r = co_await ch->recv();
+      if(r)
+      {
+        sum += r.value();
+      }
+      else if(r.error() == std::errc::broken_pipe && ch->is_closed())
+      {
+        co_return sum;
+      }
+      else if(failures != nullptr)
+      {
+        ++*failures;
+      }
+    }
+  }
+  template <class T> inline void start(T &t)
+  {
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    t.await_suspend({}).resume();
+#else
+    t.await_suspend({});
+#endif
+  }
+}  // namespace channel_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / channel, "Tests that channel<T> passes results between coroutines, suspending when full or empty")
+{
+  using namespace channel_test;
+  {
+    // The producer fills the buffer and suspends, the consumer resumes it as it drains the buffer
+    channel ch(2);
+    BOOST_CHECK(ch.capacity() == 2);
+    auto p = producer(&ch, 1, 5, 3, true);
+    start(p);
+    BOOST_CHECK(!p.await_ready());
+    int failures = 0;
+    auto c = consumer(&ch, &failures);
+    start(c);
+    BOOST_REQUIRE(p.await_ready());
+    BOOST_CHECK(p.await_resume().has_value());
+    BOOST_REQUIRE(c.await_ready());
+    BOOST_CHECK(c.await_resume().value() == 1 + 2 + 4 + 5);
+    BOOST_CHECK(failures == 1);
+  }
+  {
+    // The consumer suspends on the empty channel, and each send resumes it
+    channel ch(4);
+    auto c = consumer(&ch);
+    start(c);
+    BOOST_CHECK(!c.await_ready());
+    auto p = producer(&ch, 1, 100);
+    start(p);
+    BOOST_CHECK(p.await_ready());
+    BOOST_CHECK(!c.await_ready());
+    // Closing resumes the waiting consumer, and later sends fail
+    ch.close();
+    BOOST_REQUIRE(c.await_ready());
+    BOOST_CHECK(c.await_resume().value() == 5050);
+    auto q = producer(&ch, 1, 1);
+    start(q);
+    BOOST_CHECK(q.await_resume().error() == std::errc::broken_pipe);
+  }
+  {
+    // Closing fails a waiting sender, and buffered values remain receivable
+    channel ch(2);
+    auto p = producer(&ch, 1, 3);
+    start(p);
+    BOOST_CHECK(!p.await_ready());
+    ch.close();
+    BOOST_REQUIRE(p.await_ready());
+    BOOST_CHECK(p.await_resume().error() == std::errc::broken_pipe);
+    auto c = consumer(&ch);
+    start(c);
+    BOOST_CHECK(c.await_resume().value() == 1 + 2);
+  }
+  {
+    // A coroutine destroyed while waiting withdraws from the channel
+    channel ch(2);
+    {
+      auto c = consumer(&ch);
+      start(c);
+    }
+    auto p = producer(&ch, 1, 2);
+    start(p);
+    BOOST_CHECK(p.await_resume().has_value());
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / channel / threaded, "Tests that channel<T> loses nothing between many producers and consumers on many threads")
+{
+  using namespace channel_test;
+#ifdef NDEBUG
+  static constexpr int per_producer = 100000;
+#else
+  static constexpr int per_producer = 5000;
+#endif
+  static constexpr int producers = 4, consumers = 3;
+  channel ch(16);
+  std::vector<std::thread> threads;
+  std::vector<result<long long>> sums(consumers, result<long long>(0));
+  for(int n = 0; n < consumers; n++)
+  {
+    threads.emplace_back([&, n] { sums[n] = awaitables::sync_wait(consumer(&ch)); });
+  }
+  std::atomic<int> finished(0);
+  for(int n = 0; n < producers; n++)
+  {
+    threads.emplace_back([&, n] {
+      BOOST_CHECK(awaitables::sync_wait(producer(&ch, n * per_producer, per_producer)).has_value());
+      if(finished.fetch_add(1) == producers - 1)
+      {
+        ch.close();
+      }
+    });
+  }
+  for(auto &i : threads)
+  {
+    i.join();
+  }
+  long long sum = 0, expected = 0;
+  for(auto &i : sums)
+  {
+    sum += i.value();
+  }
+  for(long long n = 0; n < producers * per_producer; n++)
+  {
+    expected += n;
+  }
+  BOOST_CHECK(sum == expected);
+}
+#else
+int main(void)
+{
+  return 0;
+}
+#endif
@@ -0,0 +1,182 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/coroutine_executor.hpp"
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/try.hpp"
+
+#if OUTCOME_FOUND_COROUTINE_HEADER
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <thread>
+
+namespace executor_test
+{
+  namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+  template <class T> using lazy = awaitables::lazy<T>;
+  template <class T> using atomic_lazy = awaitables::atomic_lazy<T>;
+  template <class T, class E = std::error_code> using result = OUTCOME_V2_NAMESPACE::result<T, E>;
+
+  inline lazy<result<std::thread::id>> which_thread() { co_return std::this_thread::get_id(); }
+  inline lazy<void> count_up(std::atomic<int> *count)
+  {
+    count->fetch_add(1, std::memory_order_relaxed);
+    co_return;
+  }
+
+  // Burns roughly a microsecond per unit of work
+  inline unsigned spin(unsigned work)
+  {
+    volatile unsigned x = 0;
+    for(unsigned n = 0; n < work * 250; n++)
+    {
+      x = x + n;
+    }
+    return x;
+  }
+
+  // Fans out into 2^depth leaves, each run on the executor, then fans their results back in
+  inline atomic_lazy<result<unsigned>> fan_out(awaitables::work_stealing_executor &ex, unsigned depth, unsigned work, unsigned fail_at = unsigned(-1))
+  {
+    if(depth == 0)
+    {
+      co_await ex.schedule();
+      spin(work);
+      if(fail_at == 0)
+      {
+        co_return std::errc::io_error;
+      }
+      co_return 1U;
+    }
+    const unsigned half = 1U << (depth - 1);
+    OUTCOME_CO_TRY(auto v, co_await awaitables::when_all(fan_out(ex, depth - 1, work, fail_at), fan_out(ex, depth - 1, work, fail_at - half)));
+    co_return std::get<0>(v) + std::get<1>(v);
+  }
+}  // namespace executor_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / executor / deque, "Tests the work stealing deque")
+{
+  OUTCOME_V2_NAMESPACE::awaitables::detail::work_stealing_deque d(4);
+  int items[1000];
+  // The owner pops last in first out, thieves steal first in first out, and the deque grows
+  for(int n = 0; n < 10; n++)
+  {
+    d.push(&items[n]);
+  }
+  BOOST_CHECK(d.size() == 10);
+  BOOST_CHECK(d.pop() == &items[9]);
+  BOOST_CHECK(d.steal() == &items[0]);
+  BOOST_CHECK(d.size() == 8);
+  while(d.pop() != nullptr)
+  {
+  }
+  BOOST_CHECK(d.steal() == nullptr);
+
+  // Every item is taken exactly once under contention between the owner and thieves
+  std::atomic<int> taken[1000];
+  for(auto &i : taken)
+  {
+    i.store(0);
+  }
+  std::atomic<bool> done(false);
+  std::vector<std::thread> thieves;
+  for(int n = 0; n < 3; n++)
+  {
+    thieves.emplace_back([&] {
+      while(!done.load() || d.size() > 0)
+      {
+        if(void *p = d.steal())
+        {
+          taken[static_cast<int *>(p) - items].fetch_add(1);
+        }
+      }
+    });
+  }
+  for(int n = 0; n < 1000; n++)
+  {
+    d.push(&items[n]);
+    if(n % 3 == 0)
+    {
+      if(void *p = d.pop())
+      {
+        taken[static_cast<int *>(p) - items].fetch_add(1);
+      }
+    }
+  }
+  while(void *p = d.pop())
+  {
+    taken[static_cast<int *>(p) - items].fetch_add(1);
+  }
+  done.store(true);
+  for(auto &i : thieves)
+  {
+    i.join();
+  }
+  int wrong = 0;
+  for(auto &i : taken)
+  {
+    if(i.load() != 1)
+    {
+      ++wrong;
+    }
+  }
+  BOOST_CHECK(wrong == 0);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / executor, "Tests that the work stealing executor resumes coroutines on its workers")
+{
+  using namespace executor_test;
+  awaitables::work_stealing_executor ex(4);
+  BOOST_CHECK(ex.concurrency() == 4);
+  BOOST_CHECK(!ex.running_in_this_thread());
+
+  // on() runs the child on a worker
+  auto id = awaitables::sync_wait(awaitables::on(ex, which_thread()));
+  BOOST_REQUIRE(id.has_value());
+  BOOST_CHECK(id.value() != std::this_thread::get_id());
+
+  // Many coroutines posted from outside, and from within, the executor all run
+  std::atomic<int> count(0);
+  auto many = [&]() -> atomic_lazy<void> {
+    for(int n = 0; n < 1000; n++)
+    {
+      co_await awaitables::on(ex, count_up(&count));
+    }
+  };
+  awaitables::sync_wait(awaitables::on(ex, many()));
+  BOOST_CHECK(count.load() == 1000);
+
+  // Fan out and back in, with and without failure
+  auto r = awaitables::sync_wait(fan_out(ex, 6, 1));
+  BOOST_REQUIRE(r.has_value());
+  BOOST_CHECK(r.value() == 64);
+  r = awaitables::sync_wait(fan_out(ex, 6, 1, 37));
+  BOOST_CHECK(r.error() == std::errc::io_error);
+}
+#else
+int main(void)
+{
+  return 0;
+}
+#endif
@@ -0,0 +1,188 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/coroutine_reactor.hpp"
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/try.hpp"
+
+#if OUTCOME_FOUND_COROUTINE_HEADER && defined(__linux__)
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <vector>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+
+namespace reactor_test
+{
+  namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+  template <class T> using lazy = awaitables::lazy<T>;
+  template <class T, class E = std::error_code> using result = OUTCOME_V2_NAMESPACE::result<T, E>;
+
+  inline result<void> make_non_blocking(int fd)
+  {
+    const int flags = ::fcntl(fd, F_GETFL);
+    if(-1 == flags || -1 == ::fcntl(fd, F_SETFL, flags | O_NONBLOCK))
+    {
+      return std::error_code(errno, std::generic_category());
+    }
+    return OUTCOME_V2_NAMESPACE::success();
+  }
+  inline result<std::pair<awaitables::async_fd, awaitables::async_fd>> make_socketpair(awaitables::epoll_reactor &reactor)
+  {
+    int fds[2];
+    if(-1 == ::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds))
+    {
+      return std::error_code(errno, std::generic_category());
+    }
+    OUTCOME_TRY(auto a, reactor.attach(fds[0]));
+    OUTCOME_TRY(auto b, reactor.attach(fds[1]));
+    return {std::move(a), std::move(b)};
+  }
+
+  // Reads exactly `bytes`, failing on end of file
+  inline lazy<result<void>> read_exactly(awaitables::async_fd &fd, char *buffer, size_t bytes)
+  {
+    while(bytes > 0)
+    {
+      OUTCOME_CO_TRY(auto read, co_await fd.read(buffer, bytes));
+      if(read == 0)
+      {
+        co_return std::errc::connection_reset;
+      }
+      buffer += read;
+      bytes -= read;
+    }
+    co_return OUTCOME_V2_NAMESPACE::success();
+  }
+  inline lazy<result<void>> write_all(awaitables::async_fd &fd, const char *buffer, size_t bytes)
+  {
+    while(bytes > 0)
+    {
+      OUTCOME_CO_TRY(auto written, co_await fd.write(buffer, bytes));
+      buffer += written;
+      bytes -= written;
+    }
+    co_return OUTCOME_V2_NAMESPACE::success();
+  }
+  inline lazy<result<int>> accept_one(awaitables::async_fd &listener) { co_return co_await listener.accept(); }
+
+  template <class T> inline void start(T &t)
+  {
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    t.await_suspend({}).resume();
+#else
+    t.await_suspend({});
+#endif
+  }
+  // Runs the reactor until all of `ts` are ready
+  template <class... Ts> inline bool run_until_ready(awaitables::epoll_reactor &reactor, Ts &... ts)
+  {
+    while(!(ts.await_ready() && ...))
+    {
+      if(!reactor.run_once(1000))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+}  // namespace reactor_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / reactor, "Tests that the epoll reactor completes awaitable reads, writes and accepts as results")
+{
+  using namespace reactor_test;
+  auto reactor = awaitables::epoll_reactor::create();
+  BOOST_REQUIRE(reactor.has_value());
+  {
+    // A read suspends until the other end writes
+    auto pair = make_socketpair(reactor.value());
+    BOOST_REQUIRE(pair.has_value());
+    char buffer[6] = {0};
+    auto r = read_exactly(pair.value().second, buffer, 5);
+    start(r);
+    BOOST_CHECK(!r.await_ready());
+    auto w = write_all(pair.value().first, "hello", 5);
+    start(w);
+    BOOST_REQUIRE(run_until_ready(reactor.value(), r, w));
+    BOOST_CHECK(r.await_resume().has_value());
+    BOOST_CHECK(w.await_resume().has_value());
+    BOOST_CHECK(std::string(buffer) == "hello");
+
+    // A write suspends until the other end makes room, larger than any socket buffer
+    std::vector<char> big(16 * 1024 * 1024, 'x'), received(big.size());
+    auto w2 = write_all(pair.value().first, big.data(), big.size());
+    start(w2);
+    BOOST_CHECK(!w2.await_ready());
+    auto r2 = read_exactly(pair.value().second, received.data(), received.size());
+    start(r2);
+    BOOST_REQUIRE(run_until_ready(reactor.value(), r2, w2));
+    BOOST_CHECK(w2.await_resume().has_value());
+    BOOST_CHECK(r2.await_resume().has_value());
+    BOOST_CHECK(received == big);
+
+    // End of file is a successful read of zero bytes
+    pair.value().first = awaitables::async_fd();
+    auto eof = read_exactly(pair.value().second, buffer, 1);
+    start(eof);
+    BOOST_REQUIRE(run_until_ready(reactor.value(), eof));
+    BOOST_CHECK(eof.await_resume().error() == std::errc::connection_reset);
+  }
+  {
+    // Accepting suspends until a connection arrives, and failures are error codes
+    const int s = ::socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    BOOST_REQUIRE(s != -1);
+    auto listener = reactor.value().attach(s);
+    BOOST_REQUIRE(listener.has_value());
+    auto notlistening = accept_one(listener.value());
+    start(notlistening);
+    BOOST_REQUIRE(notlistening.await_ready());
+    BOOST_CHECK(notlistening.await_resume().error() == std::errc::invalid_argument);
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t len = sizeof(addr);
+    BOOST_REQUIRE(0 == ::bind(s, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)));
+    BOOST_REQUIRE(0 == ::listen(s, 1));
+    BOOST_REQUIRE(0 == ::getsockname(s, reinterpret_cast<sockaddr *>(&addr), &len));
+    auto a = accept_one(listener.value());
+    start(a);
+    BOOST_CHECK(!a.await_ready());
+    const int c = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    BOOST_REQUIRE(0 == ::connect(c, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)));
+    BOOST_REQUIRE(run_until_ready(reactor.value(), a));
+    auto accepted = a.await_resume();
+    BOOST_REQUIRE(accepted.has_value());
+    BOOST_CHECK(accepted.value() >= 0);
+    ::close(accepted.value());
+    ::close(c);
+  }
+}
+#else
+int main(void)
+{
+  return 0;
+}
+#endif
@@ -29,6 +29,8 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include "quickcpplib/boost/test/unit_test.hpp"
 
+#include <thread>
+
 namespace coroutines
 {
   template <class T> using eager = OUTCOME_V2_NAMESPACE::awaitables::eager<T>;
@@ -70,6 +72,200 @@ namespace coroutines
   }
 #endif
 
+  template <class T> struct counting_allocator
+  {
+    using value_type = T;
+    int *count;
+    explicit counting_allocator(int *c)
+        : count(c)
+    {
+    }
+    template <class U>
+    counting_allocator(const counting_allocator<U> &o)
+        : count(o.count)
+    {
+    }
+    T *allocate(size_t n)
+    {
+      ++*count;
+      return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, size_t n)
+    {
+      --*count;
+      std::allocator<T>().deallocate(p, n);
+    }
+  };
+  template <class Alloc> inline lazy<result<int>> lazy_int_alloc(std::allocator_arg_t /*unused*/, Alloc /*unused*/, int x) { co_return x + 1; }
+
+  inline lazy<result<int>> counted_int(int *started, int x)
+  {
+    ++*started;
+    co_return x;
+  }
+  inline lazy<result<std::string>> lazy_string(const char *s) { co_return s; }
+
+  // Resumes the awaiting coroutine on a new thread
+  struct resume_on_new_thread
+  {
+    std::vector<std::thread> *threads;
+    bool await_ready() noexcept { return false; }
+    void await_suspend(OUTCOME_V2_NAMESPACE::awaitables::coroutine_handle<> h) { threads->emplace_back([h] { h.resume(); }); }
+    void await_resume() noexcept {}
+  };
+  inline OUTCOME_V2_NAMESPACE::awaitables::atomic_lazy<result<int>> threaded_int(std::vector<std::thread> *threads, int x)
+  {
+    co_await resume_on_new_thread{threads};
+    co_return x;
+  }
+  inline OUTCOME_V2_NAMESPACE::awaitables::atomic_lazy<result<int>> threaded_error(std::vector<std::thread> *threads)
+  {
+    co_await resume_on_new_thread{threads};
+    co_return std::errc::not_enough_memory;
+  }
+
+  template <class T> inline void start(T &t)
+  {
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    t.await_suspend({}).resume();
+#else
+    t.await_suspend({});
+#endif
+  }
+
+  template <class T> using generator = OUTCOME_V2_NAMESPACE::awaitables::generator<T>;
+
+  inline result<int> parse_digit(char c)
+  {
+    if(c < '0' || c > '9')
+    {
+      return std::errc::invalid_argument;
+    }
+    return c - '0';
+  }
+  // Every generator must end with co_return success(), as the promise has no return_void() and
+  // flowing off the end is undefined behaviour.
+
+  // Yields every record, each of which may fail independently
+  inline generator<result<int>> parse_all(const char *s)
+  {
+    for(; *s != 0; ++s)
+    {
+      co_yield parse_digit(*s);
+    }
+    co_return OUTCOME_V2_NAMESPACE::success();
+  }
+  // Ends the stream at the first record which fails to parse
+  inline generator<result<int>> parse_until_failure(const char *s)
+  {
+    for(; *s != 0; ++s)
+    {
+      OUTCOME_CO_TRY(auto v, parse_digit(*s));
+      co_yield v;
+    }
+    co_return OUTCOME_V2_NAMESPACE::success();
+  }
+  inline generator<result<int>> await_in_generator(int count)
+  {
+    for(int n = 0; n < count; n++)
+    {
+      OUTCOME_CO_TRY(auto v, co_await lazy_int(n));
+      co_yield v;
+    }
+    co_return OUTCOME_V2_NAMESPACE::success();
+  }
+#ifdef __cpp_exceptions
+  // Ends by throwing, so never reaches the co_return success() it would otherwise need
+  inline generator<result<int>> throwing_generator()
+  {
+    co_yield 1;
+    throw std::system_error(make_error_code(std::errc::io_error));
+  }
+#endif
+
+  template <class T> using shared_lazy = OUTCOME_V2_NAMESPACE::awaitables::shared_lazy<T>;
+  template <class T> using atomic_lazy = OUTCOME_V2_NAMESPACE::awaitables::atomic_lazy<T>;
+
+  inline shared_lazy<result<std::string>> shared_fetch(std::atomic<int> *runs, std::vector<std::thread> *threads)
+  {
+    runs->fetch_add(1);
+    if(threads != nullptr)
+    {
+      co_await resume_on_new_thread{threads};
+    }
+    co_return "fetched";
+  }
+  inline atomic_lazy<result<const std::string *>> shared_consumer(shared_lazy<result<std::string>> s)
+  {
+    const result<std::string> &r = co_await s;
+    if(!r)
+    {
+      co_return r.as_failure();
+    }
+    co_return &r.assume_value();
+  }
+
+#if OUTCOME_HAVE_STOP_TOKEN
+  using OUTCOME_V2_NAMESPACE::awaitables::cancellation_point;
+  using OUTCOME_V2_NAMESPACE::awaitables::get_stop_token;
+
+  struct counted_local
+  {
+    int *alive;
+    explicit counted_local(int *a)
+        : alive(a)
+    {
+      ++*alive;
+    }
+    counted_local(const counted_local &) = delete;
+    ~counted_local() { --*alive; }
+  };
+  // Does units of work until done, or until stop is requested, after requesting it itself at `stop_at`
+  inline lazy<result<int>> cancellable_work(int *done, int *alive, std::stop_source *source, int stop_at)
+  {
+    counted_local local(alive);
+    for(int n = 0; n < 10; n++)
+    {
+      if(n == stop_at)
+      {
+        source->request_stop();
+      }
+      co_await cancellation_point();
+      ++*done;
+    }
+    co_return *done;
+  }
+  inline lazy<result<int>> cancellable_parent(int *done, int *alive, std::stop_source *source, int stop_at)
+  {
+    OUTCOME_CO_TRY(auto a, co_await cancellable_work(done, alive, source, stop_at));
+    OUTCOME_CO_TRY(auto b, co_await cancellable_work(done, alive, source, stop_at));
+    co_return a + b;
+  }
+  // Suspends until resumed from outside, then does units of work until done or until stop is requested
+  struct pause
+  {
+    OUTCOME_V2_NAMESPACE::awaitables::coroutine_handle<> *paused;
+    bool await_ready() noexcept { return false; }
+    void await_suspend(OUTCOME_V2_NAMESPACE::awaitables::coroutine_handle<> h) noexcept { *paused = h; }
+    void await_resume() noexcept {}
+  };
+  inline lazy<result<int>> paused_work(int *done, OUTCOME_V2_NAMESPACE::awaitables::coroutine_handle<> *paused)
+  {
+    co_await pause{paused};
+    for(int n = 0; n < 10; n++)
+    {
+      co_await cancellation_point();
+      ++*done;
+    }
+    co_return *done;
+  }
+  inline lazy<result<bool>> polls_stop_token()
+  {
+    auto token = co_await get_stop_token();
+    co_return token.stop_requested();
+  }
+#endif
+
   inline eager<int> eager_int2(int x) { co_return x + 1; }
   inline lazy<int> lazy_int2(int x) { co_return x + 1; }
   inline eager<void> eager_void2() { co_return; }
@@ -119,6 +315,369 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / result / coroutine, "Tests that results are
   ensure_coroutine_completed_immediately(eager_void2());
   ensure_coroutine_needs_resuming_once(lazy_void2());
 }
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / coroutine / frame_allocation, "Tests that coroutine frames are recycled and may be freed by any thread")
+{
+  using namespace coroutines;
+#if OUTCOME_COROUTINE_RECYCLE_FRAMES
+  {
+    // A frame freed by the allocating thread is reused by the next coroutine of similar size
+    void *first = nullptr;
+    {
+      auto t = lazy_int(5);
+      first = t._h.address();
+    }
+    auto t = lazy_int(6);
+    BOOST_CHECK(t._h.address() == first);
+  }
+#endif
+  {
+    // Frames freed by other threads, including after the allocating thread has exited
+    std::vector<lazy<result<int>>> frames;
+    std::thread([&] {
+      for(int n = 0; n < 100; n++)
+      {
+        frames.push_back(lazy_int(n));
+      }
+    }).join();
+    for(auto &i : frames)
+    {
+      BOOST_CHECK(!i.await_ready());
+    }
+    std::thread([&] {
+      for(int n = 0; n < 50; n++)
+      {
+        frames.pop_back();
+      }
+    }).join();
+    frames.clear();
+    std::thread([&] {
+      for(int n = 0; n < 100; n++)
+      {
+        frames.push_back(lazy_int(n));
+      }
+    }).join();
+    frames.clear();
+  }
+  {
+    // Allocator aware coroutines allocate and free through the allocator passed
+    int count = 0;
+    {
+      auto t = lazy_int_alloc(std::allocator_arg, counting_allocator<char>(&count), 5);
+      BOOST_CHECK(count == 1);
+      BOOST_CHECK(!t.await_ready());
+    }
+    BOOST_CHECK(count == 0);
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / coroutine / when_all, "Tests that when_all() and when_any() combine awaitables, deciding as early as possible")
+{
+  using namespace coroutines;
+  using OUTCOME_V2_NAMESPACE::awaitables::when_all;
+  using OUTCOME_V2_NAMESPACE::awaitables::when_any;
+  {
+    // All succeed, the values are collected into a tuple in argument order
+    auto t = when_all(lazy_int(1), lazy_string("hi"), eager_int(3));
+    static_assert(std::is_same<decltype(t), lazy<result<std::tuple<int, std::string, int>>>>::value, "");
+    BOOST_CHECK(!t.await_ready());
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    auto r = t.await_resume();
+    BOOST_REQUIRE(r.has_value());
+    BOOST_CHECK(std::get<0>(r.value()) == 2);
+    BOOST_CHECK(std::get<1>(r.value()) == "hi");
+    BOOST_CHECK(std::get<2>(r.value()) == 4);
+  }
+  {
+    // The first failure decides, and lazy children after it are never started
+    int started = 0;
+    auto t = when_all(counted_int(&started, 1), lazy_error(), counted_int(&started, 2));
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::not_enough_memory);
+    BOOST_CHECK(started == 1);
+  }
+  {
+    // The first success decides when_any(), and lazy children after it are never started
+    int started = 0;
+    auto t = when_any(lazy_error(), lazy_int(5), counted_int(&started, 1));
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 6);
+    BOOST_CHECK(started == 0);
+  }
+  {
+    // If everything fails, when_any() returns the first failure
+    auto t = when_any(lazy_error(), eager_error());
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::not_enough_memory);
+  }
+  {
+    // Children completing on other threads, the last of which resumes the combinator
+    std::vector<std::thread> threads;
+    auto t = when_all(threaded_int(&threads, 1), threaded_int(&threads, 2), threaded_int(&threads, 3));
+    static_assert(std::is_same<decltype(t), OUTCOME_V2_NAMESPACE::awaitables::atomic_lazy<result<std::tuple<int, int, int>>>>::value, "");
+    start(t);
+    for(auto &i : threads)
+    {
+      i.join();
+    }
+    BOOST_REQUIRE(t.await_ready());
+    auto r = t.await_resume();
+    BOOST_REQUIRE(r.has_value());
+    BOOST_CHECK(std::get<0>(r.value()) + std::get<1>(r.value()) + std::get<2>(r.value()) == 6);
+  }
+  {
+    // Children already running when a failure decides are still awaited, the third may be skipped
+    std::vector<std::thread> threads;
+    auto t = when_all(threaded_int(&threads, 1), threaded_error(&threads), threaded_int(&threads, 3));
+    start(t);
+    for(auto &i : threads)
+    {
+      i.join();
+    }
+    BOOST_CHECK(threads.size() >= 2);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::not_enough_memory);
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / coroutine / generator, "Tests that generator<T> streams results, stopping on or exposing failures")
+{
+  using namespace coroutines;
+  {
+    // Iterating the generator visits every result, including failures
+    auto g = parse_all("12x4");
+    std::vector<result<int>> seen;
+    for(auto &r : g)
+    {
+      seen.push_back(r);
+    }
+    BOOST_REQUIRE(seen.size() == 4);
+    BOOST_CHECK(seen[0].value() == 1);
+    BOOST_CHECK(seen[1].value() == 2);
+    BOOST_CHECK(seen[2].error() == std::errc::invalid_argument);
+    BOOST_CHECK(seen[3].value() == 4);
+    BOOST_CHECK(g.status().has_value());
+  }
+  {
+    // values() stops at the first failure, which status() then reports
+    auto g = parse_all("12x4");
+    int total = 0;
+    for(int v : g.values())
+    {
+      total += v;
+    }
+    BOOST_CHECK(total == 3);
+    BOOST_CHECK(g.status().error() == std::errc::invalid_argument);
+  }
+  {
+    auto g = parse_all("1234");
+    int total = 0;
+    for(int v : g.values())
+    {
+      total += v;
+    }
+    BOOST_CHECK(total == 10);
+    BOOST_CHECK(g.status().has_value());
+  }
+  {
+    // OUTCOME_CO_TRY inside the generator ends the stream with its failure
+    auto g = parse_until_failure("12x4");
+    std::vector<result<int>> seen;
+    for(auto &r : g)
+    {
+      seen.push_back(r);
+    }
+    BOOST_REQUIRE(seen.size() == 3);
+    BOOST_CHECK(seen[2].error() == std::errc::invalid_argument);
+  }
+  {
+    // Generators may co_await other awaitables
+    int total = 0;
+    auto g = await_in_generator(4);
+    for(int v : g.values())
+    {
+      total += v;
+    }
+    BOOST_CHECK(total == 1 + 2 + 3 + 4);
+  }
+  {
+    // Abandoning a generator part way through destroys its frame
+    auto g = parse_all("1234");
+    auto it = g.begin();
+    BOOST_CHECK(it->value() == 1);
+  }
+  {
+    // An empty stream
+    auto g = parse_all("");
+    BOOST_CHECK(g.begin() == g.end());
+  }
+#ifdef __cpp_exceptions
+  {
+    // An exception thrown inside the generator becomes its final failure
+    auto g = throwing_generator();
+    std::vector<result<int>> seen;
+    for(auto &r : g)
+    {
+      seen.push_back(r);
+    }
+    BOOST_REQUIRE(seen.size() == 2);
+    BOOST_CHECK(seen[0].value() == 1);
+    BOOST_CHECK(seen[1].error() == std::errc::io_error);
+  }
+#endif
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / coroutine / shared_lazy, "Tests that shared_lazy<T> runs once for many awaiters, handing out references to one result")
+{
+  using namespace coroutines;
+  {
+    // Awaiting a completed shared_lazy does not suspend
+    std::atomic<int> runs(0);
+    auto s = shared_fetch(&runs, nullptr);
+    BOOST_CHECK(!s.is_ready());
+    BOOST_CHECK(runs == 0);
+    auto a = shared_consumer(s), b = shared_consumer(s);
+    start(a);
+    BOOST_CHECK(s.is_ready());
+    start(b);
+    BOOST_REQUIRE(a.await_ready() && b.await_ready());
+    const std::string *pa = a.await_resume().value(), *pb = b.await_resume().value();
+    BOOST_CHECK(pa == pb);
+    BOOST_CHECK(*pa == "fetched");
+    BOOST_CHECK(runs == 1);
+  }
+  {
+    // Many awaiters registering from many threads while the fetch is in progress
+    std::atomic<int> runs(0);
+    std::vector<std::thread> fetch_threads;
+    std::vector<atomic_lazy<result<const std::string *>>> consumers[4];
+    {
+      auto s = shared_fetch(&runs, &fetch_threads);
+      std::vector<std::thread> threads;
+      for(auto &c : consumers)
+      {
+        threads.emplace_back([&c, s] {
+          for(int n = 0; n < 50; n++)
+          {
+            c.push_back(shared_consumer(s));
+            start(c.back());
+          }
+        });
+      }
+      for(auto &i : threads)
+      {
+        i.join();
+      }
+      // Consumers still hold copies, so the shared frame outlives this scope
+    }
+    for(auto &i : fetch_threads)
+    {
+      i.join();
+    }
+    BOOST_CHECK(runs == 1);
+    const std::string *p = nullptr;
+    int done = 0;
+    for(auto &c : consumers)
+    {
+      for(auto &i : c)
+      {
+        BOOST_REQUIRE(i.await_ready());
+        auto r = i.await_resume();
+        BOOST_CHECK(p == nullptr || r.value() == p);
+        p = r.value();
+        ++done;
+      }
+    }
+    BOOST_CHECK(done == 200);
+    BOOST_CHECK(*p == "fetched");
+  }
+}
+
+#if OUTCOME_HAVE_STOP_TOKEN
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / coroutine / cancellation, "Tests that lazy awaitables complete with operation_canceled once stop is requested")
+{
+  using namespace coroutines;
+  {
+    // Never requested, everything runs to completion
+    std::stop_source source;
+    int done = 0, alive = 0;
+    auto t = cancellable_parent(&done, &alive, &source, -1);
+    t.set_stop_token(source.get_token());
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 10 + 20);
+    BOOST_CHECK(alive == 0);
+  }
+  {
+    // Requested before starting, the lazy awaitable never runs
+    std::stop_source source;
+    source.request_stop();
+    int done = 0, alive = 0;
+    auto t = cancellable_parent(&done, &alive, &source, -1);
+    t.set_stop_token(source.get_token());
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::operation_canceled);
+    BOOST_CHECK(done == 0);
+    BOOST_CHECK(alive == 0);
+  }
+  {
+    // Requested from within the first child, which stops at its next cancellation point with
+    // its locals still alive until the frame is destroyed, and the second child never starts
+    std::stop_source source;
+    int done = 0, alive = 0;
+    {
+      auto t = cancellable_parent(&done, &alive, &source, 3);
+      t.set_stop_token(source.get_token());
+      start(t);
+      BOOST_REQUIRE(t.await_ready());
+      BOOST_CHECK(t.await_resume().error() == std::errc::operation_canceled);
+      BOOST_CHECK(done == 3);
+    }
+    BOOST_CHECK(alive == 0);
+  }
+  {
+    // The stop token is visible within the coroutine, and inherited through when_all()
+    std::stop_source source;
+    auto t = polls_stop_token();
+    t.set_stop_token(source.get_token());
+    start(t);
+    BOOST_CHECK(t.await_resume().value() == false);
+    int done = 0, alive = 0;
+    auto w = OUTCOME_V2_NAMESPACE::awaitables::when_all(cancellable_work(&done, &alive, &source, 5), polls_stop_token());
+    w.set_stop_token(source.get_token());
+    start(w);
+    BOOST_REQUIRE(w.await_ready());
+    BOOST_CHECK(w.await_resume().error() == std::errc::operation_canceled);
+    BOOST_CHECK(done == 5);
+  }
+  {
+    // A sibling running when the answer is decided is cut short at its next cancellation point
+    int done = 0;
+    OUTCOME_V2_NAMESPACE::awaitables::coroutine_handle<> paused;
+    auto w = OUTCOME_V2_NAMESPACE::awaitables::when_all(paused_work(&done, &paused), lazy_error());
+    start(w);
+    BOOST_REQUIRE(paused);
+    BOOST_CHECK(!w.await_ready());
+    paused.resume();
+    BOOST_REQUIRE(w.await_ready());
+    BOOST_CHECK(w.await_resume().error() == std::errc::not_enough_memory);
+    BOOST_CHECK(done == 0);
+    paused = nullptr;
+    auto a = OUTCOME_V2_NAMESPACE::awaitables::when_any(paused_work(&done, &paused), lazy_int(5));
+    start(a);
+    BOOST_REQUIRE(paused);
+    paused.resume();
+    BOOST_REQUIRE(a.await_ready());
+    BOOST_CHECK(a.await_resume().value() == 6);
+    BOOST_CHECK(done == 0);
+  }
+}
+#endif
 #else
 int main(void)
 {
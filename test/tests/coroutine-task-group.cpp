@@ -0,0 +1,196 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/coroutine_executor.hpp"
+#include "../../include/outcome/coroutine_task_group.hpp"
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/try.hpp"
+
+#if OUTCOME_FOUND_COROUTINE_HEADER && OUTCOME_HAVE_STOP_TOKEN
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <atomic>
+
+namespace task_group_test
+{
+  namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+  template <class T> using lazy = awaitables::lazy<T>;
+  template <class T> using atomic_lazy = awaitables::atomic_lazy<T>;
+  template <class T, class E = std::error_code> using result = OUTCOME_V2_NAMESPACE::result<T, E>;
+  using group_type = awaitables::task_group<result<int>>;
+
+  static std::atomic<int> started, alive;
+
+  // Counts the frames alive which hold one
+  struct counted
+  {
+    counted() { alive.fetch_add(1, std::memory_order_relaxed); }
+    counted(const counted &) = delete;
+    ~counted() { alive.fetch_sub(1, std::memory_order_relaxed); }
+  };
+
+  // A shard whose frame comes from the group's arena
+  inline lazy<result<int>> shard(std::allocator_arg_t /*unused*/, group_type::allocator_type /*unused*/, int n, int fail_at)
+  {
+    started.fetch_add(1, std::memory_order_relaxed);
+    if(n == fail_at)
+    {
+      co_return std::errc::io_error;
+    }
+    co_return n * 2;
+  }
+  // A shard which fails at once if it is the one to fail, otherwise runs on the executor until cancelled
+  inline atomic_lazy<result<int>> remote_shard(std::allocator_arg_t /*unused*/, group_type::allocator_type /*unused*/, awaitables::work_stealing_executor &ex, int n, int fail_at)
+  {
+    counted c;
+    started.fetch_add(1, std::memory_order_relaxed);
+    if(n == fail_at)
+    {
+      co_return std::errc::io_error;
+    }
+    for(;;)
+    {
+      co_await ex.schedule();
+      co_await awaitables::cancellation_point();
+    }
+  }
+  inline lazy<result<int>> gather(awaitables::work_stealing_executor &ex, group_type &group, int shards, int fail_at)
+  {
+    for(int n = 0; n < shards; n++)
+    {
+      OUTCOME_CO_TRY(group.spawn(remote_shard(std::allocator_arg, group.get_allocator(), ex, n, fail_at)));
+    }
+    OUTCOME_CO_TRY(co_await group.join());
+    co_return shards;
+  }
+
+  template <class T> inline void start(T &t)
+  {
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    t.await_suspend({}).resume();
+#else
+    t.await_suspend({});
+#endif
+  }
+}  // namespace task_group_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / task_group, "Tests that a task group joins all its children, failing fast on the first failure")
+{
+  using namespace task_group_test;
+  group_type group(128);
+  for(int round = 0; round < 3; round++)
+  {
+    // Every child completes, and their values are in the order spawned
+    started = 0;
+    for(int n = 0; n < 128; n++)
+    {
+      BOOST_CHECK(group.spawn(shard(std::allocator_arg, group.get_allocator(), n, -1)).has_value());
+    }
+    BOOST_CHECK(group.size() == 128);
+    BOOST_CHECK(group.spawn(shard(std::allocator_arg, group.get_allocator(), 128, -1)).error() == std::errc::no_buffer_space);
+    BOOST_CHECK(group.arena_used() > 0);
+    BOOST_CHECK(group.arena_used() <= 128 * group_type::default_arena_bytes_per_child);
+    auto j = group.join();
+    start(j);
+    BOOST_REQUIRE(j.await_ready());
+    BOOST_CHECK(j.await_resume().has_value());
+    BOOST_CHECK(started == 128);
+    for(int n = 0; n < 128; n++)
+    {
+      BOOST_CHECK(group.values()[n] == n * 2);
+    }
+    group.reset();
+    BOOST_CHECK(group.size() == 0);
+    BOOST_CHECK(group.arena_used() == 0);
+  }
+  {
+    // Children not yet started when one fails are never started
+    started = 0;
+    for(int n = 0; n < 10; n++)
+    {
+      BOOST_CHECK(group.spawn(shard(std::allocator_arg, group.get_allocator(), n, 3)).has_value());
+    }
+    auto j = group.join();
+    start(j);
+    BOOST_REQUIRE(j.await_ready());
+    BOOST_CHECK(j.await_resume().error() == std::errc::io_error);
+    BOOST_CHECK(started == 4);
+    group.reset();
+  }
+  {
+    // Children too big for the arena come from the heap instead
+    awaitables::task_group<result<int>> small(4, 16);
+    for(int n = 0; n < 4; n++)
+    {
+      BOOST_CHECK(small.spawn(shard(std::allocator_arg, small.get_allocator(), n, -1)).has_value());
+    }
+    auto j = small.join();
+    start(j);
+    BOOST_REQUIRE(j.await_ready());
+    BOOST_CHECK(j.await_resume().has_value());
+    BOOST_CHECK(small.values()[3] == 6);
+  }
+  {
+    // Cancellation of the joining coroutine passes on to the children
+    started = 0;
+    std::stop_source source;
+    source.request_stop();
+    for(int n = 0; n < 10; n++)
+    {
+      BOOST_CHECK(group.spawn(shard(std::allocator_arg, group.get_allocator(), n, -1)).has_value());
+    }
+    auto j = group.join();
+    j.set_stop_token(source.get_token());
+    start(j);
+    BOOST_REQUIRE(j.await_ready());
+    BOOST_CHECK(j.await_resume().error() == std::errc::operation_canceled);
+    BOOST_CHECK(started == 0);
+    group.reset();
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / task_group / threaded, "Tests that a task group cancels its running children on the first failure")
+{
+  using namespace task_group_test;
+  awaitables::work_stealing_executor ex(4);
+  group_type group(64);
+  for(int round = 0; round < 10; round++)
+  {
+    started = 0;
+    auto r = awaitables::sync_wait(gather(ex, group, 64, 40));
+    BOOST_CHECK(r.error() == std::errc::io_error);
+    // The children after the failure were never started, and those before it were cancelled
+    // where they stood, keeping their locals until destroyed
+    BOOST_CHECK(started == 41);
+    BOOST_CHECK(alive == 40);
+    group.reset();
+    BOOST_CHECK(alive == 0);
+  }
+}
+#else
+int main(void)
+{
+  return 0;
+}
+#endif
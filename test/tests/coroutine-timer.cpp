@@ -0,0 +1,202 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/coroutine_timer.hpp"
+#include "../../include/outcome.hpp"
+#include "../../include/outcome/try.hpp"
+
+#if OUTCOME_FOUND_COROUTINE_HEADER && OUTCOME_HAVE_STOP_TOKEN
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace timer_test
+{
+  namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+  template <class T> using lazy = awaitables::lazy<T>;
+  template <class T, class E = std::error_code> using result = OUTCOME_V2_NAMESPACE::result<T, E>;
+
+  // Records the tick of the wheel at which it fired
+  struct recording_timer : awaitables::detail::wheel_timer
+  {
+    const awaitables::detail::timer_wheel *wheel;
+    uint64_t fired_at{0};
+
+    explicit recording_timer(const awaitables::detail::timer_wheel *w)
+        : wheel(w)
+    {
+      fire = [](wheel_timer *t) noexcept {
+        auto *self = static_cast<recording_timer *>(t);
+        self->fired_at = self->wheel->now();
+      };
+    }
+  };
+
+  inline lazy<result<int>> quick(int v) { co_return v; }
+  // Polls for cancellation, taking about a millisecond per iteration
+  inline lazy<result<int>> slow(int iterations)
+  {
+    for(int n = 0; n < iterations; n++)
+    {
+      co_await awaitables::cancellation_point();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    co_return iterations;
+  }
+  // Takes about a millisecond per iteration without ever observing cancellation
+  inline lazy<result<int>> uninterruptible(int iterations)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(iterations));
+    co_return iterations;
+  }
+  inline lazy<result<int>> parent(awaitables::timer_service &service, int iterations, std::chrono::milliseconds timeout)
+  {
+    co_return co_await awaitables::with_deadline(service, slow(iterations), timeout);
+  }
+
+  template <class T> inline void start(T &t)
+  {
+#if OUTCOME_HAVE_NOOP_COROUTINE
+    t.await_suspend({}).resume();
+#else
+    t.await_suspend({});
+#endif
+  }
+}  // namespace timer_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / timer / wheel, "Tests that the hierarchical timer wheel expires each timer on its tick")
+{
+  using namespace timer_test;
+  auto wheel = std::make_unique<awaitables::detail::timer_wheel>();
+  // Either side of each level's span, and beyond the span of the whole wheel
+  const uint64_t expiries[] = {1, 2, 63, 64, 65, 127, 4095, 4096, 4097, 262143, 262144, 262145, 16777215, 16777216, 20000000};
+  std::vector<std::unique_ptr<recording_timer>> timers;
+  for(uint64_t expiry : expiries)
+  {
+    timers.push_back(std::make_unique<recording_timer>(wheel.get()));
+    timers.back()->expiry = expiry;
+    wheel->add(timers.back().get());
+  }
+  // A removed timer never fires
+  recording_timer removed(wheel.get());
+  removed.expiry = 4096;
+  wheel->add(&removed);
+  wheel->remove(&removed);
+  BOOST_CHECK(wheel->size() == timers.size());
+
+  awaitables::detail::wheel_timer expired;
+  for(uint64_t tick = 1; tick <= 20000000; tick++)
+  {
+    wheel->advance(tick, expired);
+    while(expired.linked())
+    {
+      auto *t = expired.next;
+      t->unlink();
+      t->fire(t);
+    }
+  }
+  BOOST_CHECK(wheel->size() == 0);
+  for(size_t n = 0; n < timers.size(); n++)
+  {
+    BOOST_CHECK(timers[n]->fired_at == expiries[n]);
+  }
+  BOOST_CHECK(removed.fired_at == 0);
+
+  // A timer added for a tick already passed expires on the next
+  recording_timer late(wheel.get());
+  late.expiry = 5;
+  wheel->add(&late);
+  BOOST_CHECK(wheel->next_due() == wheel->now() + 1);
+  wheel->advance(wheel->now() + 1, expired);
+  BOOST_CHECK(expired.next == &late);
+  expired.next->unlink();
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / coroutine / timer / deadline, "Tests that with_deadline() completes with timed_out if the deadline passes first")
+{
+  using namespace timer_test;
+  awaitables::timer_service service;
+  {
+    // A child completing in time yields its result
+    auto t = awaitables::with_deadline(service, quick(5), std::chrono::seconds(10));
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 5);
+  }
+  {
+    // A child running past its deadline is cancelled at its next cancellation point
+    auto begin = std::chrono::steady_clock::now();
+    auto t = parent(service, 10000, std::chrono::milliseconds(20));
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::timed_out);
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+    BOOST_CHECK(elapsed >= std::chrono::milliseconds(20));
+    BOOST_CHECK(elapsed < std::chrono::seconds(5));
+  }
+  {
+    // A deadline passing after the child has completed does not replace its result
+    auto t = awaitables::with_deadline(service, uninterruptible(30), std::chrono::milliseconds(5));
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().value() == 30);
+  }
+  {
+    // Cancellation of the awaiting coroutine passes on to the child, and is not a timeout
+    std::stop_source source;
+    source.request_stop();
+    auto t = parent(service, 10000, std::chrono::seconds(10));
+    t.set_stop_token(source.get_token());
+    start(t);
+    BOOST_REQUIRE(t.await_ready());
+    BOOST_CHECK(t.await_resume().error() == std::errc::operation_canceled);
+  }
+  {
+    // Many deadlines expiring close together all fire on the timer thread
+    std::stop_source source;
+    std::deque<awaitables::detail::deadline_timer> timers;
+    for(size_t n = 0; n < 1000; n++)
+    {
+      timers.emplace_back(&source);
+      service.schedule(timers.back(), std::chrono::microseconds(n * 20));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    size_t fired = 0;
+    for(auto &timer : timers)
+    {
+      fired += service.cancel(timer);
+    }
+    BOOST_CHECK(fired == timers.size());
+    BOOST_CHECK(source.stop_requested());
+  }
+}
+#else
+int main(void)
+{
+  return 0;
+}
+#endif
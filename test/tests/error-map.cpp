@@ -0,0 +1,119 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/error_map.hpp"
+#include "../../include/outcome/result.hpp"
+#include "../../include/outcome/try.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <future>  // for future_category
+
+namespace error_map_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  enum class storage_errc
+  {
+    unknown = 1,
+    not_found,
+    no_space,
+    busy,
+    refused
+  };
+
+  // Entries name their category by its getter, and the map holds each category named once
+  static constexpr auto storage_errors = outcome::make_error_map(storage_errc::unknown,  //
+                                                                 outcome::map_error<&std::generic_category>(std::errc::no_such_file_or_directory, storage_errc::not_found),
+                                                                 outcome::map_error<&std::generic_category>(std::errc::no_space_on_device, storage_errc::no_space),
+                                                                 outcome::map_error<&std::generic_category>(std::errc::device_or_resource_busy, storage_errc::busy),
+                                                                 outcome::map_error<&std::system_category>(ECONNREFUSED, storage_errc::refused),
+                                                                 outcome::map_error<&std::generic_category>(std::errc::no_such_file_or_directory, storage_errc::busy));
+  static_assert(std::is_same<decltype(storage_errors), const outcome::error_map<storage_errc, 5, &std::generic_category, &std::system_category>>::value, "");
+  static_assert(storage_errors.lookup<&std::generic_category>(ENOSPC) == storage_errc::no_space, "");
+  static_assert(storage_errors.lookup<&std::generic_category>(ENOENT) == storage_errc::not_found, "first duplicate should win");
+  static_assert(storage_errors.lookup<&std::system_category>(ECONNREFUSED) == storage_errc::refused, "");
+  static_assert(storage_errors.lookup<&std::system_category>(ENOENT) == storage_errc::unknown, "");
+  // A category not in the map, by getter or by position, maps to the default
+  static_assert(storage_errors.lookup<&std::future_category>(ENOSPC) == storage_errc::unknown, "");
+  static_assert(storage_errors.lookup(2, ENOSPC) == storage_errc::unknown, "");
+  static_assert(storage_errors.lookup(size_t(-1), ENOSPC) == storage_errc::unknown, "");
+
+  outcome::result<int> open_file(std::errc e)
+  {
+    if(e == std::errc())
+    {
+      return 5;
+    }
+    return e;
+  }
+
+  outcome::unchecked<int, storage_errc> read_block(std::errc e)
+  {
+    OUTCOME_TRY_MAP(storage_errors, auto fd, open_file(e));
+    return fd * 2;
+  }
+
+  outcome::unchecked<void, storage_errc> touch(std::errc e)
+  {
+    OUTCOME_TRY_MAP([](const std::error_code &ec) { return ec ? storage_errc::refused : storage_errc::unknown; }, open_file(e));
+    return outcome::success();
+  }
+}  // namespace error_map_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / error_map, "Tests that OUTCOME_TRY_MAP maps errors through a compile time table")
+{
+  using namespace error_map_test;
+  BOOST_CHECK(read_block(std::errc()).value() == 10);
+  BOOST_CHECK(read_block(std::errc::no_such_file_or_directory).error() == storage_errc::not_found);
+  BOOST_CHECK(read_block(std::errc::no_space_on_device).error() == storage_errc::no_space);
+  BOOST_CHECK(read_block(std::errc::device_or_resource_busy).error() == storage_errc::busy);
+  BOOST_CHECK(read_block(std::errc::permission_denied).error() == storage_errc::unknown);
+  BOOST_CHECK(touch(std::errc()).has_value());
+  BOOST_CHECK(touch(std::errc::permission_denied).error() == storage_errc::refused);
+
+  BOOST_CHECK(storage_errors(std::error_code(ECONNREFUSED, std::system_category())) == storage_errc::refused);
+  // Same value, different category
+  BOOST_CHECK(storage_errors(std::error_code(ECONNREFUSED, std::generic_category())) == storage_errc::unknown);
+  BOOST_CHECK(storage_errors(std::error_code(ENOSPC, std::future_category())) == storage_errc::unknown);
+  BOOST_CHECK(storage_errors.max_probe() == 0);
+
+  {
+    // Large and sparse tables must still map every entry
+    static constexpr auto sparse = outcome::make_error_map(-1,                                                  //
+                                                           outcome::map_error<&std::generic_category>(0, 0),        //
+                                                           outcome::map_error<&std::generic_category>(1 << 20, 1),  //
+                                                           outcome::map_error<&std::generic_category>(-5, 2),       //
+                                                           outcome::map_error<&std::system_category>(0, 3),         //
+                                                           outcome::map_error<&std::system_category>(255, 4),       //
+                                                           outcome::map_error<&std::system_category>(256, 5),       //
+                                                           outcome::map_error<&std::system_category>(257, 6),       //
+                                                           outcome::map_error<&std::generic_category>(1 << 30, 7),  //
+                                                           outcome::map_error<&std::generic_category>(8, 8));
+    static_assert(sparse.lookup<&std::generic_category>(1 << 20) == 1, "");
+    static_assert(sparse.lookup<&std::generic_category>(-5) == 2, "");
+    static_assert(sparse.lookup<&std::system_category>(257) == 6, "");
+    static_assert(sparse.lookup<&std::generic_category>(9) == -1, "");
+    BOOST_CHECK(sparse(std::error_code(1 << 30, std::generic_category())) == 7);
+    BOOST_CHECK(sparse(std::error_code(256, std::system_category())) == 5);
+  }
+}
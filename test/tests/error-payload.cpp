@@ -0,0 +1,155 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/error_payload.hpp"
+#include "../../include/outcome/outcome.hpp"
+#include "../../include/outcome/try.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+namespace error_payload_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  // A key and value describing a failure, held without allocating
+  struct context
+  {
+    const char *key{nullptr};
+    char value[24]{};
+
+    context() = default;
+    context(const char *k, const char *v)
+        : key(k)
+    {
+      strncpy(value, v, sizeof(value) - 1);
+    }
+  };
+  using arena = outcome::error_payload_arena<context, 8>;
+
+  inline outcome::result<int> parse(const char *s)
+  {
+    if(*s < '0' || *s > '9')
+    {
+      return outcome::failure(std::errc::invalid_argument, arena::this_thread().emplace("input", s));
+    }
+    return *s - '0';
+  }
+  inline outcome::result<double> half(const char *s)
+  {
+    OUTCOME_TRY(auto v, parse(s));
+    return v / 2.0;
+  }
+}  // namespace error_payload_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / error_payload, "Tests that an error payload in the per-thread arena follows the failure")
+{
+  using namespace error_payload_test;
+  {
+    // The handle is carried by failure(), as_failure() and TRY
+    auto r = half("x");
+    BOOST_REQUIRE(r.has_error());
+    const context *c = arena::this_thread().find(r);
+    BOOST_REQUIRE(c != nullptr);
+    BOOST_CHECK(0 == strcmp(c->key, "input"));
+    BOOST_CHECK(0 == strcmp(c->value, "x"));
+    BOOST_CHECK(arena::this_thread().find(half("4")) == nullptr);
+    // And by the converting constructors
+    outcome::outcome<double> o(r);
+    BOOST_CHECK(arena::this_thread().find(o) == c);
+    outcome::basic_result<int, std::errc, outcome::policy::all_narrow> e(std::errc::permission_denied);
+    arena::this_thread().attach(e, "user", "nobody");
+    outcome::result<int> r2(e);
+    BOOST_CHECK(r2.error() == std::errc::permission_denied);
+    BOOST_REQUIRE(arena::this_thread().find(r2) != nullptr);
+    BOOST_CHECK(0 == strcmp(arena::this_thread().find(r2)->value, "nobody"));
+    outcome::outcome<int> o2(std::move(e));
+    BOOST_CHECK(arena::this_thread().find(o2) == arena::this_thread().find(r2));
+  }
+  {
+    // Payloads may be fetched until their slot is recycled
+    auto r = half("y");
+    const uint16_t handle = outcome::hooks::spare_storage(&r);
+    for(size_t n = 1; n < arena::slots; n++)
+    {
+      arena::this_thread().emplace("n", "");
+    }
+    BOOST_CHECK(arena::this_thread().find(r) != nullptr);
+    arena::this_thread().emplace("n", "");
+    BOOST_CHECK(arena::this_thread().find(r) == nullptr);
+    // Handles are never zero, so a result without a payload never finds one
+    for(size_t n = 0; n < 70000; n++)
+    {
+      BOOST_CHECK(arena::this_thread().emplace("n", "") != 0);
+    }
+    BOOST_CHECK(arena::this_thread().get(0) == nullptr);
+    BOOST_CHECK(arena::this_thread().get(handle) == nullptr);
+  }
+  {
+    // Handles wrap after 65535 payloads, whereupon a stale handle finds the payload reissued it
+    const uint16_t first = arena::this_thread().emplace("w", "first");
+    for(size_t n = 1; n < 65535; n++)
+    {
+      arena::this_thread().emplace("n", "");
+    }
+    BOOST_CHECK(arena::this_thread().emplace("w", "again") == first);
+    BOOST_REQUIRE(arena::this_thread().get(first) != nullptr);
+    BOOST_CHECK(0 == strcmp(arena::this_thread().get(first)->value, "again"));
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / error_payload / threaded, "Tests that an error payload made on another thread is found through that thread's arena")
+{
+  using namespace error_payload_test;
+  // Each thread's arena issues the same handles, so a result failed on one thread must be looked up
+  // in the arena of that thread
+  outcome::result<double> r(0.0);
+  const arena *theirs = nullptr;
+  bool looked_up = false;
+  std::mutex lock;
+  std::condition_variable cond;
+  std::thread t([&] {
+    auto mine = half("z");
+    std::unique_lock<std::mutex> g(lock);
+    r = std::move(mine);
+    theirs = &arena::this_thread();
+    cond.notify_all();
+    // The arena of this thread must outlive the look up, and not be written meanwhile
+    cond.wait(g, [&] { return looked_up; });
+  });
+  {
+    std::unique_lock<std::mutex> g(lock);
+    cond.wait(g, [&] { return theirs != nullptr; });
+    BOOST_REQUIRE(r.has_error());
+    const context *c = theirs->find(r);
+    BOOST_REQUIRE(c != nullptr);
+    BOOST_CHECK(0 == strcmp(c->value, "z"));
+    BOOST_CHECK(theirs != &arena::this_thread());
+    looked_up = true;
+    cond.notify_all();
+  }
+  t.join();
+}
@@ -0,0 +1,182 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/utils.hpp"
+
+#ifdef __cpp_exceptions
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <future>  // for future_error
+#include <thread>
+
+namespace exception_error_registry_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  struct storage_failure : std::runtime_error
+  {
+    int block;
+    explicit storage_failure(int b)
+        : std::runtime_error("storage failure")
+        , block(b)
+    {
+    }
+  };
+  struct disk_full : storage_failure
+  {
+    disk_full()
+        : storage_failure(0)
+    {
+    }
+  };
+  struct unrelated
+  {
+  };
+  template <int N> struct numbered : std::runtime_error
+  {
+    numbered()
+        : std::runtime_error("numbered")
+    {
+    }
+  };
+  static const std::exception_ptr numbered_exceptions[] = {
+  std::make_exception_ptr(numbered<0>()), std::make_exception_ptr(numbered<1>()), std::make_exception_ptr(numbered<2>()), std::make_exception_ptr(numbered<3>()),
+  std::make_exception_ptr(numbered<4>()), std::make_exception_ptr(numbered<5>()), std::make_exception_ptr(numbered<6>()), std::make_exception_ptr(numbered<7>())};
+}  // namespace exception_error_registry_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / utils / exception_error_registry, "Tests that exceptions are mapped to error codes through a registry")
+{
+  using namespace exception_error_registry_test;
+  outcome::exception_error_registry registry;
+  const std::error_code not_matched = std::make_error_code(std::errc::state_not_recoverable);
+  // Twice each, so the second is answered from the cache where the standard library supports it
+  for(int n = 0; n < 2; n++)
+  {
+    auto ep = std::make_exception_ptr(std::out_of_range("out of range"));
+    BOOST_CHECK(registry.lookup(ep, not_matched) == std::errc::result_out_of_range);
+    BOOST_CHECK(!ep);
+    ep = std::make_exception_ptr(disk_full());
+    BOOST_CHECK(registry.lookup(ep, not_matched) == std::errc::resource_unavailable_try_again);
+    ep = std::make_exception_ptr(std::bad_alloc());
+    BOOST_CHECK(registry.lookup(ep, not_matched) == std::errc::not_enough_memory);
+    // Unmatched exceptions are left in place
+    ep = std::make_exception_ptr(unrelated());
+    BOOST_CHECK(registry.lookup(ep, not_matched) == not_matched);
+    BOOST_CHECK(ep);
+    // The code of a system_error is that of each object thrown, not of its type
+    ep = std::make_exception_ptr(std::system_error(std::make_error_code(std::errc::io_error)));
+    BOOST_CHECK(registry.lookup(ep, not_matched) == std::errc::io_error);
+    ep = std::make_exception_ptr(std::system_error(std::make_error_code(std::errc::broken_pipe)));
+    BOOST_CHECK(registry.lookup(ep, not_matched) == std::errc::broken_pipe);
+  }
+  std::exception_ptr none;
+  BOOST_CHECK(!registry.lookup(none, not_matched));
+
+  // Mappings added since take precedence over what was remembered, and later mappings over earlier
+  BOOST_CHECK(registry.add<storage_failure>(std::make_error_code(std::errc::io_error)));
+  BOOST_CHECK(registry.add<unrelated>(std::make_error_code(std::errc::not_supported)));
+  for(int n = 0; n < 2; n++)
+  {
+    auto ep = std::make_exception_ptr(disk_full());
+    BOOST_CHECK(registry.lookup(ep, not_matched) == std::errc::io_error);
+    ep = std::make_exception_ptr(unrelated());
+    BOOST_CHECK(registry.lookup(ep, not_matched) == std::errc::not_supported);
+  }
+  BOOST_CHECK(registry.add<storage_failure>(+[](const storage_failure &e) { return std::error_code(e.block, std::generic_category()); }));
+  BOOST_CHECK(registry.add<disk_full>(std::make_error_code(std::errc::no_space_on_device)));
+  BOOST_CHECK(registry.size() == 4);
+  {
+    auto ep = std::make_exception_ptr(disk_full());
+    BOOST_CHECK(registry.lookup(ep, not_matched) == std::errc::no_space_on_device);
+    ep = std::make_exception_ptr(storage_failure(EROFS));
+    BOOST_CHECK(registry.lookup(ep, not_matched) == std::errc::read_only_file_system);
+    ep = std::make_exception_ptr(storage_failure(EBUSY));
+    BOOST_CHECK(registry.lookup(ep, not_matched) == std::errc::device_or_resource_busy);
+  }
+  while(registry.size() < outcome::exception_error_registry::max_mappings)
+  {
+    BOOST_CHECK(registry.add<unrelated>(std::make_error_code(std::errc::not_supported)));
+  }
+  BOOST_CHECK(!registry.add<unrelated>(std::make_error_code(std::errc::not_supported)));
+
+  // error_from_exception() uses the registry returned by exception_error_mappings()
+  BOOST_CHECK(outcome::error_from_exception(std::make_exception_ptr(std::future_error(std::future_errc::no_state))) == std::errc::invalid_argument);
+  BOOST_CHECK(outcome::error_from_exception(std::make_exception_ptr(disk_full())) == std::errc::resource_unavailable_try_again);
+  outcome::exception_error_mappings().add<disk_full>(std::make_error_code(std::errc::no_space_on_device));
+  BOOST_CHECK(outcome::error_from_exception(std::make_exception_ptr(disk_full())) == std::errc::no_space_on_device);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / utils / exception_error_registry / stale, "Tests that mappings added after lookups many times over are honoured")
+{
+  using namespace exception_error_registry_test;
+  outcome::exception_error_registry registry;
+  const std::error_code not_matched = std::make_error_code(std::errc::state_not_recoverable);
+  // Far more types are remembered over all the generations than the cache has slots, while
+  // another thread keeps looking up the same types
+  std::atomic<bool> done{false};
+  std::atomic<int> misread{0};
+  std::thread reader([&] {
+    while(!done.load(std::memory_order_relaxed))
+    {
+      for(const auto &i : numbered_exceptions)
+      {
+        auto ep = i;
+        const std::error_code ec = registry.lookup(ep, not_matched);
+        if(ec != std::errc::resource_unavailable_try_again && ec.category() != std::generic_category())
+        {
+          misread.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    }
+  });
+  for(int generation = 1; generation < static_cast<int>(outcome::exception_error_registry::max_mappings); generation++)
+  {
+    BOOST_REQUIRE(registry.add<numbered<0>>(std::error_code(generation, std::generic_category())));
+    for(int n = 0; n < 100; n++)
+    {
+      for(size_t i = 0; i < 8; i++)
+      {
+        auto ep = numbered_exceptions[i];
+        const std::error_code ec = registry.lookup(ep, not_matched);
+        if(i == 0)
+        {
+          BOOST_CHECK(ec == std::error_code(generation, std::generic_category()));
+        }
+        else
+        {
+          BOOST_CHECK(ec == std::errc::resource_unavailable_try_again);
+        }
+      }
+    }
+  }
+  done = true;
+  reader.join();
+  BOOST_CHECK(misread == 0);
+}
+#else
+int main(void)
+{
+  return 0;
+}
+#endif
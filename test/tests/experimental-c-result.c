@@ -0,0 +1,97 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* The C half of experimental-c-result.cpp, which calls into C++ through
+the C ABI in a tight loop.
+*/
+
+#include <errno.h>
+#include <stddef.h>
+
+#include "../../include/outcome/experimental/result.h"
+
+CXX_DECLARE_RESULT_SYSTEM(c_result_test, size_t);
+CXX_DECLARE_RESULT_SYSTEM(c_result_test_int, int);
+
+// Implemented in C++
+extern CXX_RESULT_SYSTEM(c_result_test) c_result_test_parse(const char *s);
+
+// Calls c_result_test_parse() on each string rounds times, returning the sum of the values and counting the failures
+size_t c_result_test_sum(const char *const *strings, size_t count, size_t rounds, size_t *failures)
+{
+  size_t total = 0, round, n;
+  *failures = 0;
+  for(round = 0; round < rounds; round++)
+  {
+    for(n = 0; n < count; n++)
+    {
+      CXX_RESULT_SYSTEM(c_result_test) r = c_result_test_parse(strings[n]);
+      if(CXX_RESULT_HAS_VALUE(r))
+      {
+        total += r.value;
+      }
+      else if(CXX_RESULT_HAS_ERROR(r) && r.error.value == EINVAL)
+      {
+        ++*failures;
+      }
+    }
+  }
+  return total;
+}
+
+// Parses a decimal digit
+static CXX_RESULT_SYSTEM(c_result_test_int) parse_digit(char c)
+{
+  CXX_RESULT_SYSTEM(c_result_test_int) r;
+  if(c < '0' || c > '9')
+  {
+    CXX_RESULT_SET_ERRNO(r, EINVAL);
+    return r;
+  }
+  CXX_RESULT_SET_VALUE(r, c - '0');
+  return r;
+}
+
+// Parses two decimal digits, for C++ to call
+CXX_RESULT_SYSTEM(c_result_test) c_result_test_parse_pair(const char *s)
+{
+  CXX_RESULT_SYSTEM(c_result_test) r;
+  CXX_RESULT_TRY(tens, CXX_RESULT_SYSTEM(c_result_test), parse_digit(s[0]));
+  CXX_RESULT_TRY(units, CXX_RESULT_SYSTEM(c_result_test), parse_digit(s[1]));
+  if(s[2] != 0)
+  {
+    CXX_RESULT_SET_ERRNO(r, EOVERFLOW);
+    return r;
+  }
+  CXX_RESULT_SET_VALUE(r, (size_t) (tens * 10 + units));
+  return r;
+}
+
+// Checks that the first character is a decimal digit, for C++ to call
+CXX_RESULT_SYSTEM(c_result_test) c_result_test_check_digit(const char *s)
+{
+  CXX_RESULT_SYSTEM(c_result_test) r;
+  CXX_RESULT_TRY(CXX_RESULT_SYSTEM(c_result_test), parse_digit(s[0]));
+  CXX_RESULT_SET_VALUE(r, 1);
+  return r;
+}
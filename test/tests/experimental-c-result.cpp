@@ -0,0 +1,229 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/experimental/c_result_view.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstring>
+#include <system_error>
+
+CXX_DECLARE_RESULT_SYSTEM(c_result_test, size_t);
+CXX_DECLARE_RESULT_SYSTEM(c_result_test_int, int);
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+CXX_DECLARE_RESULT_ERRNO(c_result_test, int);
+#endif
+CXX_DECLARE_RESULT(c_result_test_union, int, long);
+CXX_DECLARE_RESULT_STATUS_CODE(c_result_test_short, short, struct cxx_status_code_system);
+
+namespace c_result_test
+{
+  namespace outcome_e = OUTCOME_V2_NAMESPACE::experimental;
+  using result_type = outcome_e::status_result<size_t>;
+  using c_result_type = CXX_RESULT_SYSTEM(c_result_test);
+
+  static_assert(outcome_e::is_c_result_layout_compatible<c_result_type, result_type>::value, "");
+  static_assert(outcome_e::is_c_result_layout_compatible<CXX_RESULT_SYSTEM(c_result_test_int), outcome_e::status_result<int>>::value, "");
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+  static_assert(outcome_e::is_c_result_layout_compatible<CXX_RESULT_ERRNO(c_result_test), outcome_e::status_result<int, outcome_e::posix_code>>::value, "");
+#endif
+  // A different value type, or a value too small to pad the status bits up to an unsigned, does not lay out the same
+  static_assert(!outcome_e::is_c_result_layout_compatible<CXX_RESULT_SYSTEM(c_result_test_int), result_type>::value, "");
+  static_assert(!outcome_e::is_c_result_layout_compatible<CXX_RESULT_STATUS_CODE(system_c_result_test_short), outcome_e::status_result<short>>::value, "");
+  static_assert(!outcome_e::is_c_result_layout_compatible<c_result_type, OUTCOME_V2_NAMESPACE::basic_result<size_t, std::error_code, OUTCOME_V2_NAMESPACE::policy::all_narrow>>::value, "");
+
+  // A basic_result of trivially copyable types lays out as the union based C struct
+  using union_result_type = OUTCOME_V2_NAMESPACE::basic_result<int, long, OUTCOME_V2_NAMESPACE::policy::all_narrow>;
+  using union_state_type = std::decay_t<decltype(std::declval<union_result_type &>()._iostreams_state())>;
+  static_assert(std::is_standard_layout<union_state_type>::value, "");
+  static_assert(sizeof(union_result_type) == sizeof(CXX_RESULT(c_result_test_union)), "");
+  static_assert(alignof(union_result_type) == alignof(CXX_RESULT(c_result_test_union)), "");
+  static_assert(offsetof(union_state_type, _value) == offsetof(CXX_RESULT(c_result_test_union), value), "");
+  static_assert(offsetof(union_state_type, _error) == offsetof(CXX_RESULT(c_result_test_union), error), "");
+  static_assert(offsetof(union_state_type, _status) == offsetof(CXX_RESULT(c_result_test_union), flags), "");
+
+  // Parses a decimal number
+  OUTCOME_NOINLINE inline result_type parse(const char *s) noexcept
+  {
+    if(*s == 0)
+    {
+      return outcome_e::errc::invalid_argument;
+    }
+    size_t v = 0;
+    for(; *s != 0; ++s)
+    {
+      if(*s < '0' || *s > '9')
+      {
+        return outcome_e::errc::invalid_argument;
+      }
+      v = v * 10 + static_cast<size_t>(*s - '0');
+    }
+    return v;
+  }
+}  // namespace c_result_test
+
+extern "C" CXX_RESULT_SYSTEM(c_result_test) c_result_test_parse(const char *s)
+{
+  return OUTCOME_V2_NAMESPACE::experimental::to_c_result<c_result_test::c_result_type>(c_result_test::parse(s));
+}
+// Implemented in experimental-c-result.c
+extern "C" size_t c_result_test_sum(const char *const *strings, size_t count, size_t rounds, size_t *failures);
+extern "C" CXX_RESULT_SYSTEM(c_result_test) c_result_test_parse_pair(const char *s);
+extern "C" CXX_RESULT_SYSTEM(c_result_test) c_result_test_check_digit(const char *s);
+
+OUTCOME_C_RESULT_DEFINE_ERRNO_DOMAIN();
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / c_result / view, "Tests that a status_result and the C struct from result.h view one another")
+{
+  using namespace c_result_test;
+  {
+    result_type r(5);
+    c_result_type &c = outcome_e::as_c_result<c_result_type>(r);
+    BOOST_CHECK(CXX_RESULT_HAS_VALUE(c));
+    BOOST_CHECK(!CXX_RESULT_HAS_ERROR(c));
+    BOOST_CHECK(c.value == 5);
+    c.value = 6;
+    BOOST_CHECK(r.value() == 6);
+  }
+  {
+    result_type r(outcome_e::errc::invalid_argument);
+    const c_result_type &c = outcome_e::as_c_result<c_result_type>(static_cast<const result_type &>(r));
+    BOOST_CHECK(!CXX_RESULT_HAS_VALUE(c));
+    BOOST_CHECK(CXX_RESULT_HAS_ERROR(c));
+    BOOST_CHECK(c.error.domain == &r.error().domain());
+    BOOST_CHECK(c.error.value == EINVAL);
+    // And back again
+    const result_type &r2 = outcome_e::as_status_result<const result_type>(c);
+    BOOST_CHECK(&r2 == &r);
+    BOOST_CHECK(r2.error() == outcome_e::errc::invalid_argument);
+  }
+  {
+    // Ownership passes to the C struct and back again
+    c_result_type c = outcome_e::to_c_result<c_result_type>(parse("x"));
+    BOOST_CHECK(CXX_RESULT_HAS_ERROR(c));
+    result_type r = outcome_e::from_c_result<result_type>(static_cast<c_result_type &&>(c));
+    BOOST_CHECK(r.error() == outcome_e::errc::invalid_argument);
+    BOOST_CHECK(c.error.domain == nullptr);
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / c_result / batch, "Tests that an array of status_result and an array of the C struct view one another")
+{
+  using namespace c_result_test;
+  static const char *const strings[] = {"0", "1", "x", "22", "", "333", "4444", "5y"};
+  static constexpr size_t count = sizeof(strings) / sizeof(strings[0]);
+  c_result_type cs[count];
+  for(size_t n = 0; n < count; n++)
+  {
+    cs[n] = c_result_test_parse(strings[n]);
+  }
+  const result_type *rs = outcome_e::as_status_results<const result_type>(static_cast<const c_result_type *>(cs));
+  size_t total = 0, failures = 0;
+  for(size_t n = 0; n < count; n++)
+  {
+    if(rs[n].has_value())
+    {
+      total += rs[n].value();
+    }
+    else if(rs[n].error() == outcome_e::errc::invalid_argument)
+    {
+      ++failures;
+    }
+  }
+  BOOST_CHECK(total == 4800);
+  BOOST_CHECK(failures == 3);
+  // Writes through the C array are seen in the status_result array
+  c_result_type *cs2 = outcome_e::as_c_results<c_result_type>(outcome_e::as_status_results<result_type>(cs));
+  BOOST_CHECK(cs2 == cs);
+  cs2[0].value = 7;
+  BOOST_CHECK(rs[0].value() == 7);
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / c_result / from_c, "Tests that C code can return status_result to C++ using the result.h macros")
+{
+  using namespace c_result_test;
+  {
+    // Both are trivially copyable, so may be copied as bits
+    CXX_RESULT(c_result_test_union) c;
+    union_result_type r(OUTCOME_V2_NAMESPACE::in_place_type<int>, 0);
+    CXX_RESULT_SET_VALUE(c, 5);
+    memcpy(static_cast<void *>(&r), &c, sizeof(r));
+    BOOST_CHECK(r.value() == 5);
+    CXX_RESULT_SET_ERROR(c, 6L);
+    memcpy(static_cast<void *>(&r), &c, sizeof(r));
+    BOOST_CHECK(r.error() == 6L);
+  }
+  {
+    result_type r = outcome_e::from_c_result<result_type>(c_result_test_parse_pair("42"));
+    BOOST_CHECK(r.value() == 42);
+  }
+  {
+    // The errno is seen in C++ as a code of the errno domain
+    c_result_type c = c_result_test_parse_pair("4x");
+    BOOST_CHECK(CXX_RESULT_ERROR_IS_ERRNO(c));
+    result_type r = outcome_e::from_c_result<result_type>(static_cast<c_result_type &&>(c));
+    BOOST_REQUIRE(r.has_error());
+    BOOST_CHECK(r.error() == outcome_e::errc::invalid_argument);
+    BOOST_CHECK(outcome_e::from_c_result<result_type>(c_result_test_parse_pair("x4")).error() == outcome_e::errc::invalid_argument);
+    BOOST_CHECK(outcome_e::from_c_result<result_type>(c_result_test_parse_pair("444")).error() == outcome_e::errc::value_too_large);
+  }
+  {
+    BOOST_CHECK(outcome_e::from_c_result<result_type>(c_result_test_check_digit("4")).value() == 1);
+    BOOST_CHECK(outcome_e::from_c_result<result_type>(c_result_test_check_digit("x")).error() == outcome_e::errc::invalid_argument);
+  }
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / c_result / c_abi, "Tests calling a C++ function returning a status_result from C in a tight loop")
+{
+  using namespace c_result_test;
+#ifdef NDEBUG
+  static constexpr size_t rounds = 1000000;
+#else
+  static constexpr size_t rounds = 10000;
+#endif
+  static const char *const strings[] = {"0", "1", "x", "22", "", "333", "4444", "5y"};
+  static constexpr size_t count = sizeof(strings) / sizeof(strings[0]);
+  size_t failures = 0;
+  const size_t total = c_result_test_sum(strings, count, rounds, &failures);
+  BOOST_CHECK(total == 4800 * rounds);
+  BOOST_CHECK(failures == 3 * rounds);
+  // The same from C++
+  size_t total2 = 0, failures2 = 0;
+  for(size_t round = 0; round < rounds; round++)
+  {
+    for(size_t n = 0; n < count; n++)
+    {
+      result_type r = parse(strings[n]);
+      if(r.has_value())
+      {
+        total2 += r.value();
+      }
+      else if(r.error() == outcome_e::errc::invalid_argument)
+      {
+        ++failures2;
+      }
+    }
+  }
+  BOOST_CHECK(total2 == total);
+  BOOST_CHECK(failures2 == failures);
+}
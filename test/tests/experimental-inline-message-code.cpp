@@ -0,0 +1,138 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/experimental/inline_message_code.hpp"
+#include "../../include/outcome/experimental/status-code/include/status_code_ptr.hpp"
+#include "../../include/outcome/try.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+// Counts allocations, to show that failures with inline messages make none
+static size_t allocations;
+void *operator new(size_t bytes)
+{
+  ++allocations;
+  if(void *p = malloc(bytes))
+  {
+    return p;
+  }
+  abort();
+}
+void operator delete(void *p) noexcept
+{
+  free(p);
+}
+void operator delete(void *p, size_t /*unused*/) noexcept
+{
+  free(p);
+}
+
+namespace inline_message_code_test
+{
+  namespace outcome_e = OUTCOME_V2_NAMESPACE::experimental;
+  template <class T> using result = outcome_e::status_result<T, outcome_e::inline_message_code>;
+
+  static_assert(std::is_trivially_copyable<outcome_e::inline_message_code::value_type>::value, "");
+  static_assert(OUTCOME_V2_NAMESPACE::trait::is_move_bitcopying<outcome_e::inline_message_code>::value, "");
+
+  inline bool same(const outcome_e::inline_message_code::string_ref &a, const char *b)
+  {
+    return a.size() == strlen(b) && 0 == memcmp(a.data(), b, a.size());
+  }
+
+  OUTCOME_NOINLINE inline result<int> lookup(const char *key) noexcept
+  {
+    if(key[0] != 'k')
+    {
+      return outcome_e::inline_message_code(outcome_e::in_place, outcome_e::errc::invalid_argument, "key does not begin with 'k'");
+    }
+    return static_cast<int>(strlen(key));
+  }
+  inline result<int> lookup_twice(const char *key) noexcept
+  {
+    OUTCOME_TRY(auto v, lookup(key));
+    return v * 2;
+  }
+
+  // The same, but with the message in a payload on the heap
+  OUTCOME_NOINLINE inline outcome_e::status_result<int> lookup_ptr(const char *key) noexcept
+  {
+    if(key[0] != 'k')
+    {
+      return outcome_e::make_status_code_ptr(outcome_e::inline_message_code(outcome_e::in_place, outcome_e::errc::invalid_argument, "key does not begin with 'k'"));
+    }
+    return static_cast<int>(strlen(key));
+  }
+  inline outcome_e::status_result<int> lookup_ptr_twice(const char *key) noexcept
+  {
+    OUTCOME_TRY(auto v, lookup_ptr(key));
+    return v * 2;
+  }
+}  // namespace inline_message_code_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / inline_message, "Tests that the inline message code carries its message inline")
+{
+  using namespace inline_message_code_test;
+  {
+    outcome_e::inline_message_code c(outcome_e::in_place, outcome_e::errc::no_such_file_or_directory, "config.toml not found");
+    BOOST_CHECK(c.failure());
+    BOOST_CHECK(same(c.message(), "config.toml not found"));
+    BOOST_CHECK(c == outcome_e::errc::no_such_file_or_directory);
+    BOOST_CHECK(c != outcome_e::errc::permission_denied);
+    // The message is diagnostic only
+    BOOST_CHECK(c == outcome_e::inline_message_code(outcome_e::in_place, outcome_e::errc::no_such_file_or_directory, "other"));
+    BOOST_CHECK(!outcome_e::inline_message_code(outcome_e::in_place, outcome_e::errc::success, "").failure());
+  }
+  {
+    // Long messages are truncated
+    const char *msg = "0123456789012345678901234567890123456789012345678901234567890123456789";
+    outcome_e::inline_message_code c(outcome_e::in_place, outcome_e::errc::invalid_argument, msg);
+    BOOST_CHECK(c.message().size() == 47);
+    BOOST_CHECK(same(c.message(), std::string(msg, 47).c_str()));
+    BOOST_CHECK(c.message().data()[47] == 0);
+    // But not in the middle of a UTF-8 character
+    outcome_e::basic_inline_message_code<8> d(outcome_e::in_place, outcome_e::errc::invalid_argument, "abcdef\xc3\xa9");
+    BOOST_CHECK(same(d.message(), "abcdef"));
+    outcome_e::basic_inline_message_code<8> e(outcome_e::in_place, outcome_e::errc::invalid_argument, "abcde\xc3\xa9");
+    BOOST_CHECK(same(e.message(), "abcde\xc3\xa9"));
+  }
+  {
+    // Failures propagate through status_result with no allocation
+    const size_t before = allocations;
+    auto r = lookup_twice("xyz");
+    BOOST_CHECK(allocations == before);
+    BOOST_REQUIRE(r.has_error());
+    BOOST_CHECK(r.error() == outcome_e::errc::invalid_argument);
+    BOOST_CHECK(same(r.error().message(), "key does not begin with 'k'"));
+    BOOST_CHECK(lookup_twice("key").value() == 6);
+    // Whereas a payload on the heap needs one
+    auto r2 = lookup_ptr_twice("xyz");
+    BOOST_CHECK(allocations == before + 1);
+    BOOST_CHECK(r2.error() == outcome_e::errc::invalid_argument);
+  }
+}
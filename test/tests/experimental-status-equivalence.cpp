@@ -0,0 +1,79 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/experimental/status_equivalence.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+namespace status_equivalence_test
+{
+  namespace outcome_e = OUTCOME_V2_NAMESPACE::experimental;
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+  using platform_domain = outcome_e::_posix_code_domain;
+  using platform_code = outcome_e::posix_code;
+#else
+  using platform_domain = outcome_e::_generic_code_domain;
+  using platform_code = outcome_e::generic_code;
+#endif
+
+  inline platform_code code_of(int n) { return platform_code(SYSTEM_ERROR2_NAMESPACE::in_place, static_cast<platform_domain::value_type>(n)); }
+}  // namespace status_equivalence_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / equivalence_table, "Tests that tabulated equivalence to errc matches asking the domains")
+{
+  using namespace status_equivalence_test;
+  outcome_e::status_equivalence_table table;
+  BOOST_REQUIRE(table.add<platform_domain>(code_of(0).value(), code_of(200).value()));
+  size_t equivalences = 0;
+  for(int v = -5; v < 300; v++)
+  {
+    const platform_code c = code_of(v);
+    const outcome_e::system_code erased(c);
+    for(int e = 0; e < 300; e++)
+    {
+      const bool expected = (c == outcome_e::generic_code(static_cast<outcome_e::errc>(e)));
+      BOOST_CHECK(table.equivalent(c, static_cast<outcome_e::errc>(e)) == expected);
+      BOOST_CHECK(table.equivalent(erased, static_cast<outcome_e::errc>(e)) == expected);
+      equivalences += expected;
+    }
+  }
+  BOOST_CHECK(equivalences > 100);
+  // Domains not added are asked
+  const outcome_e::generic_code g(outcome_e::errc::timed_out);
+  BOOST_CHECK(table.equivalent(g, outcome_e::errc::timed_out));
+  BOOST_CHECK(!table.equivalent(g, outcome_e::errc::io_error));
+  BOOST_CHECK(!table.equivalent(outcome_e::system_code(), outcome_e::errc::io_error));
+  // Adding a domain again replaces its table
+  BOOST_CHECK(table.add<platform_domain>(code_of(0).value(), code_of(10).value()));
+  BOOST_CHECK(table.equivalent(code_of(ETIMEDOUT), outcome_e::errc::timed_out));
+  while(table.add<platform_domain>(code_of(0).value(), code_of(1).value()))
+  {
+  }
+
+  // Results compare their error, if any
+  outcome_e::status_equivalences().add<platform_domain>(code_of(0).value(), code_of(200).value());
+  outcome_e::status_result<int> r(code_of(ENOENT)), s(5);
+  BOOST_CHECK(outcome_e::is_equivalent(r, outcome_e::errc::no_such_file_or_directory));
+  BOOST_CHECK(!outcome_e::is_equivalent(r, outcome_e::errc::permission_denied));
+  BOOST_CHECK(!outcome_e::is_equivalent(s, outcome_e::errc::no_such_file_or_directory));
+}
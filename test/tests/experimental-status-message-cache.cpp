@@ -0,0 +1,130 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/experimental/status_message_cache.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace status_message_cache_test
+{
+  namespace outcome_e = OUTCOME_V2_NAMESPACE::experimental;
+
+  inline bool same(const outcome_e::status_message_cache::string_ref &a, const outcome_e::status_message_cache::string_ref &b)
+  {
+    return a.size() == b.size() && 0 == memcmp(a.data(), b.data(), a.size());
+  }
+  // A code for errno value `n`, whose message comes from the platform where it can
+  inline outcome_e::system_code code_of(int n)
+  {
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    return outcome_e::posix_code(n);
+#else
+    return outcome_e::generic_code(static_cast<outcome_e::errc>(n));
+#endif
+  }
+}  // namespace status_message_cache_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / message_cache, "Tests that status code messages are interned by domain and value")
+{
+  using namespace status_message_cache_test;
+  outcome_e::status_message_cache cache(64);
+  const outcome_e::generic_code a(outcome_e::errc::no_such_file_or_directory), b(outcome_e::errc::permission_denied);
+  auto ma = cache.message(a);
+  BOOST_CHECK(same(ma, a.message()));
+  BOOST_CHECK(same(cache.message(b), b.message()));
+  // Asked again, the same interned copy is returned
+  BOOST_CHECK(cache.message(a).data() == ma.data());
+  BOOST_CHECK(cache.message(b).data() != ma.data());
+  // The same value of the same domain type erased shares the interned copy
+  outcome_e::system_code erased(a);
+  BOOST_CHECK(cache.message(erased).data() == ma.data());
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+  // The same value in another domain does not
+  const outcome_e::posix_code p(ENOENT);
+  BOOST_CHECK(same(cache.message(p), p.message()));
+  BOOST_CHECK(cache.message(p).data() != ma.data());
+#endif
+  BOOST_CHECK(same(cache.message(outcome_e::system_code()), outcome_e::system_code().message()));
+
+  // An erased code whose value is a pointer to the real code is not interned by that pointer
+  for(int e : {ENOENT, EACCES, ETIMEDOUT})
+  {
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    const outcome_e::system_code c(outcome_e::make_status_code_ptr(outcome_e::posix_code(e)));
+#else
+    const outcome_e::system_code c(outcome_e::make_status_code_ptr(outcome_e::generic_code(static_cast<outcome_e::errc>(e))));
+#endif
+    BOOST_CHECK(same(cache.message(c), code_of(e).message()));
+    BOOST_CHECK(same(cache.message(c), code_of(e).message()));
+  }
+
+  // Once full, messages are still correct
+  outcome_e::status_message_cache small(4);
+  for(int n = 1; n < 100; n++)
+  {
+    const outcome_e::system_code c = code_of(n);
+    BOOST_CHECK(same(small.message(c), c.message()));
+  }
+
+  // Results and outcomes return the message of their error, if any
+  outcome_e::status_result<int> r(outcome_e::errc::no_such_file_or_directory), s(5);
+  BOOST_CHECK(same(outcome_e::cached_message(r), a.message()));
+  BOOST_CHECK(outcome_e::cached_message(s).empty());
+  outcome_e::status_outcome<int> o(outcome_e::errc::permission_denied);
+  BOOST_CHECK(same(outcome_e::cached_message(o), b.message()));
+  BOOST_CHECK(outcome_e::cached_message(o).data() == outcome_e::cached_message(o).data());
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / message_cache / threaded, "Tests that status code messages interned concurrently are interned once")
+{
+  using namespace status_message_cache_test;
+  outcome_e::status_message_cache cache;
+  std::atomic<bool> go{false};
+  std::vector<std::thread> threads;
+  std::vector<std::vector<const char *>> seen(4);
+  for(size_t t = 0; t < seen.size(); t++)
+  {
+    threads.emplace_back([&, t] {
+      while(!go.load(std::memory_order_acquire))
+      {
+      }
+      for(int n = 1; n < 100; n++)
+      {
+        seen[t].push_back(cache.message(code_of(n)).data());
+      }
+    });
+  }
+  go.store(true, std::memory_order_release);
+  for(auto &t : threads)
+  {
+    t.join();
+  }
+  for(size_t t = 1; t < seen.size(); t++)
+  {
+    BOOST_CHECK(seen[t] == seen[0]);
+  }
+}
@@ -0,0 +1,81 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#define OUTCOME_OUTLINE_TRY_FAILURES 1
+#include "../../include/outcome/outcome.hpp"
+#include "../../include/outcome/try.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+namespace outline_failure_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  outcome::result<int> a(int x)
+  {
+    if(x < 0)
+    {
+      return outcome::outline_failure(std::errc::invalid_argument, 78);
+    }
+    return x;
+  }
+  outcome::result<int> b(int x)
+  {
+    OUTCOME_TRY(auto v, a(x));
+    return v + 1;
+  }
+  outcome::outcome<double> c(int x)
+  {
+    OUTCOME_TRY(auto v, b(x));
+    return v * 2.0;
+  }
+  outcome::result<void> d(int x)
+  {
+    OUTCOME_TRY(a(x));
+    return outcome::success();
+  }
+}  // namespace outline_failure_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / outline_failure, "Tests that failures constructed out of line behave like inline ones")
+{
+  using namespace outline_failure_test;
+  static_assert(std::is_same<decltype(outcome::outline_failure(5)), outcome::outlined_failure_type<int>>::value, "");
+  static_assert(std::is_same<decltype(outcome::outline_failure(outcome::failure(5))), outcome::outlined_failure_type<int>>::value, "");
+  static_assert(std::is_convertible<outcome::outlined_failure_type<std::errc>, outcome::result<int>>::value, "");
+  static_assert(!std::is_convertible<outcome::outlined_failure_type<std::errc>, int>::value, "");
+  BOOST_CHECK(b(5).value() == 6);
+  BOOST_CHECK(c(5).value() == 12.0);
+  BOOST_CHECK(d(5).has_value());
+  auto r = b(-1);
+  BOOST_REQUIRE(r.has_error());
+  BOOST_CHECK(r.error() == std::errc::invalid_argument);
+  BOOST_CHECK(outcome::hooks::spare_storage(&r) == 78);
+  auto o = c(-1);
+  BOOST_REQUIRE(o.has_error());
+  BOOST_CHECK(o.error() == std::errc::invalid_argument);
+  BOOST_CHECK(outcome::hooks::spare_storage(&o) == 78);
+  BOOST_CHECK(d(-1).error() == std::errc::invalid_argument);
+
+  // Converting from a different error type goes through the same thunk
+  outcome::result<int> e = outcome::outline_failure(std::make_error_code(std::errc::timed_out));
+  BOOST_CHECK(e.error() == std::errc::timed_out);
+}
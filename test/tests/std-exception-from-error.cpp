@@ -0,0 +1,154 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/utils.hpp"
+
+#ifdef __cpp_exceptions
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstring>
+#include <future>  // for future_category
+
+namespace std_exception_from_error_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  // What try_throw_std_exception_from_error() throws for `ec`, or nullptr if it returns
+  inline std::exception_ptr thrown(std::error_code ec, const std::string &msg = std::string{})
+  {
+    try
+    {
+      outcome::try_throw_std_exception_from_error(ec, msg);
+    }
+    catch(...)
+    {
+      return std::current_exception();
+    }
+    return nullptr;
+  }
+  template <class E> inline bool thrown_is(const std::exception_ptr &ep)
+  {
+    try
+    {
+      std::rethrow_exception(ep);
+    }
+    catch(const E & /*unused*/)
+    {
+      return true;
+    }
+    catch(...)
+    {
+    }
+    return false;
+  }
+  inline const char *thrown_what(const std::exception_ptr &ep)
+  {
+    try
+    {
+      std::rethrow_exception(ep);
+    }
+    catch(const std::exception &e)
+    {
+      return e.what();
+    }
+  }
+}  // namespace std_exception_from_error_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / utils / try_throw_std_exception_from_error, "Tests that try_throw_std_exception_from_error() throws the exception matching each errno")
+{
+  using namespace std_exception_from_error_test;
+  BOOST_CHECK(thrown_is<std::invalid_argument>(thrown(std::make_error_code(std::errc::invalid_argument))));
+  BOOST_CHECK(thrown_is<std::domain_error>(thrown(std::make_error_code(std::errc::argument_out_of_domain))));
+  BOOST_CHECK(thrown_is<std::length_error>(thrown(std::make_error_code(std::errc::argument_list_too_long))));
+  BOOST_CHECK(thrown_is<std::out_of_range>(thrown(std::make_error_code(std::errc::result_out_of_range))));
+  BOOST_CHECK(thrown_is<std::overflow_error>(thrown(std::make_error_code(std::errc::value_too_large))));
+  BOOST_CHECK(thrown_is<std::bad_alloc>(thrown(std::make_error_code(std::errc::not_enough_memory))));
+  BOOST_CHECK(0 == strcmp(thrown_what(thrown(std::make_error_code(std::errc::invalid_argument))), "invalid argument"));
+  BOOST_CHECK(0 == strcmp(thrown_what(thrown(std::make_error_code(std::errc::invalid_argument), "bad flags")), "bad flags"));
+
+  // Every other errno value has no nearer standard exception, so nothing is thrown
+  const std::errc others[] = {std::errc::permission_denied, std::errc::no_such_file_or_directory, std::errc::io_error, std::errc::timed_out,
+                              std::errc::connection_refused, std::errc::resource_unavailable_try_again, std::errc::state_not_recoverable};
+  for(std::errc e : others)
+  {
+    BOOST_CHECK(!thrown(std::make_error_code(e)));
+  }
+#ifndef _WIN32
+  BOOST_CHECK(!thrown(std::error_code(ENOENT, std::system_category())));
+  BOOST_CHECK(thrown_is<std::invalid_argument>(thrown(std::error_code(EINVAL, std::system_category()))));
+#endif
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)
+  // Without a message, each throw shares the message of the first rather than allocating its own
+  BOOST_CHECK(thrown_what(thrown(std::make_error_code(std::errc::invalid_argument))) == thrown_what(thrown(std::make_error_code(std::errc::invalid_argument))));
+#endif
+
+  // No success, nor code of another category, nor unknown errno value, throws
+  BOOST_CHECK(!thrown(std::error_code()));
+  BOOST_CHECK(!thrown(std::make_error_code(std::future_errc::no_state)));
+  BOOST_CHECK(!thrown(std::error_code(-1, std::generic_category())));
+  BOOST_CHECK(!thrown(std::error_code(100000, std::generic_category())));
+}
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / utils / throw_std_exception_from_error, "Tests that throw_std_exception_from_error() throws system_error where there is no nearer exception")
+{
+  using namespace std_exception_from_error_test;
+  auto always_thrown = [](std::error_code ec, const std::string &msg = std::string{}) {
+    try
+    {
+      outcome::throw_std_exception_from_error(ec, msg);
+    }
+    catch(...)
+    {
+      return std::current_exception();
+    }
+  };
+  BOOST_CHECK(thrown_is<std::invalid_argument>(always_thrown(std::make_error_code(std::errc::invalid_argument))));
+  BOOST_CHECK(thrown_is<std::bad_alloc>(always_thrown(std::make_error_code(std::errc::not_enough_memory))));
+  // Every other code throws a system_error with that code, which error_from_exception() maps back
+  const std::error_code others[] = {std::make_error_code(std::errc::permission_denied), std::make_error_code(std::errc::io_error),
+                                    std::make_error_code(std::errc::state_not_recoverable), std::make_error_code(std::future_errc::no_state),
+                                    std::error_code(100000, std::generic_category())};
+  for(const std::error_code &ec : others)
+  {
+    auto ep = always_thrown(ec);
+    BOOST_CHECK(thrown_is<std::system_error>(ep));
+    BOOST_CHECK(outcome::error_from_exception(std::move(ep)) == ec);
+  }
+  const std::error_code ec(ENOENT, std::generic_category());
+  BOOST_CHECK(0 == strcmp(thrown_what(always_thrown(ec, "opening config")), std::system_error(ec, "opening config").what()));
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)
+  // Without a message, each system_error for an errno value shares the message of the first
+  BOOST_CHECK(thrown_what(always_thrown(std::make_error_code(std::errc::io_error))) == thrown_what(always_thrown(std::make_error_code(std::errc::io_error))));
+#ifndef _WIN32
+  BOOST_CHECK(thrown_what(always_thrown(std::error_code(EIO, std::system_category()))) == thrown_what(always_thrown(std::error_code(EIO, std::system_category()))));
+  BOOST_CHECK(outcome::error_from_exception(always_thrown(std::error_code(EIO, std::system_category()))) == std::error_code(EIO, std::system_category()));
+#endif
+#endif
+}
+#else
+int main(void)
+{
+  return 0;
+}
+#endif
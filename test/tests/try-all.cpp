@@ -0,0 +1,105 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/result.hpp"
+#include "../../include/outcome/try.hpp"
+#include "../../include/outcome/try_all.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <string>
+#include <vector>
+
+namespace try_all_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  outcome::result<int> sum(std::vector<outcome::result<int>> &v)
+  {
+    OUTCOME_TRY(auto &&values, outcome::try_all(v));
+    int ret = 0;
+    for(int i : values)
+    {
+      ret += i;
+    }
+    return ret;
+  }
+}  // namespace try_all_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / result / try_all, "Tests that try_all finds the first failure in a batch of results")
+{
+  using namespace try_all_test;
+  // Every length up to a few SIMD blocks, with the failure in every position
+  for(size_t n = 0; n < 40; n++)
+  {
+    std::vector<outcome::result<int>> v;
+    for(size_t i = 0; i < n; i++)
+    {
+      v.emplace_back(static_cast<int>(i));
+    }
+    auto r = outcome::try_all(v);
+    BOOST_REQUIRE(r.has_value());
+    BOOST_CHECK(r.value().size() == n);
+    int expected = 0;
+    for(size_t i = 0; i < n; i++)
+    {
+      BOOST_CHECK(r.value()[i] == static_cast<int>(i));
+      expected += static_cast<int>(i);
+    }
+    BOOST_CHECK(sum(v).value() == expected);
+    for(size_t fail = 0; fail < n; fail++)
+    {
+      auto w = v;
+      w[fail] = std::errc::invalid_argument;
+      outcome::hooks::set_spare_storage(&w[fail], 78);
+      if(fail + 1 < n)
+      {
+        // Only the first failure is reported
+        w[n - 1] = std::errc::not_enough_memory;
+      }
+      auto e = outcome::try_all(w);
+      BOOST_REQUIRE(e.has_error());
+      BOOST_CHECK(e.error() == std::errc::invalid_argument);
+      BOOST_CHECK(outcome::hooks::spare_storage(&e) == 78);
+      BOOST_CHECK(sum(w).error() == std::errc::invalid_argument);
+    }
+  }
+  {
+    // Larger than the status bitfield and not a multiple of it
+    std::vector<outcome::result<std::string>> a(11, std::string("hello"));
+    const auto &ca = a;
+    auto r = outcome::try_all(ca);
+    BOOST_REQUIRE(r.has_value());
+    for(const std::string &i : r.value())
+    {
+      BOOST_CHECK(i == "hello");
+    }
+    a[9] = std::errc::timed_out;
+    BOOST_CHECK(outcome::try_all(a).error() == std::errc::timed_out);
+  }
+  {
+    outcome::result<void> a[5] = {outcome::success(), outcome::success(), outcome::success(), outcome::success(), outcome::success()};
+    BOOST_CHECK(outcome::try_all(a).has_value());
+    a[4] = std::errc::no_such_file_or_directory;
+    BOOST_CHECK(outcome::try_all(a).error() == std::errc::no_such_file_or_directory);
+  }
+}